@@ -0,0 +1,87 @@
+#include "Allocations.hpp"
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+
+#if defined(LU_PLATFORM_WINDOWS)
+	#include <malloc.h>
+#endif
+
+namespace
+{
+	static std::atomic<uint64_t> s_Count = 0;
+	static std::atomic<uint64_t> s_Bytes = 0;
+
+	static void Count(size_t size)
+	{
+		s_Count.fetch_add(1, std::memory_order_relaxed);
+		s_Bytes.fetch_add(size, std::memory_order_relaxed);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Static methods
+////////////////////////////////////////////////////////////////////////////////////
+Allocations::Counters Allocations::Get()
+{
+	return { s_Count.load(std::memory_order_relaxed), s_Bytes.load(std::memory_order_relaxed) };
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Global operators
+////////////////////////////////////////////////////////////////////////////////////
+// Note: The array & nothrow versions forward to these by default
+void* operator new(size_t size)
+{
+	Count(size);
+
+	void* ptr = std::malloc(size ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+// Note: Used for types with an alignment above __STDCPP_DEFAULT_NEW_ALIGNMENT__
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	Count(size);
+
+	const size_t align = static_cast<size_t>(alignment);
+	const size_t rounded = ((size ? size : 1) + align - 1) & ~(align - 1); // Note: aligned_alloc requires a multiple of the alignment
+
+	#if defined(LU_PLATFORM_WINDOWS)
+	void* ptr = _aligned_malloc(rounded, align);
+	#else
+	void* ptr = std::aligned_alloc(align, rounded);
+	#endif
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	#if defined(LU_PLATFORM_WINDOWS)
+	_aligned_free(ptr);
+	#else
+	std::free(ptr);
+	#endif
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept
+{
+	operator delete(ptr, alignment);
+}
\ No newline at end of file
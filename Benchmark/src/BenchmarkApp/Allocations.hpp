@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////////
+// Allocations
+////////////////////////////////////////////////////////////////////////////////////
+// Note: Counts every global operator new (including the aligned ones), Lunar is linked statically so its allocations are included.
+class Allocations
+{
+public:
+	struct Counters
+	{
+	public:
+		uint64_t Count = 0;
+		uint64_t Bytes = 0;
+	};
+public:
+	// Static methods
+	static Counters Get();
+};
\ No newline at end of file
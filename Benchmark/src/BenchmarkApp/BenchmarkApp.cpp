@@ -0,0 +1,182 @@
+#include "BenchmarkApp.hpp"
+
+#include "Lunar/Internal/Utils/Timings.hpp"
+
+#include "BenchmarkApp/Allocations.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////
+// Constructor & Destructor
+////////////////////////////////////////////////////////////////////////////////////
+BenchmarkApp::BenchmarkApp(const BenchmarkSpecification& specs)
+	: m_Specification(specs)
+{
+	// Note: VSync would measure the display instead of Lunar
+	m_Window.Init({
+		.Title = "Benchmark",
+		.Width = specs.Width, .Height = specs.Height,
+
+		.VSync = false,
+		.Headless = specs.Headless,
+	});
+	m_Window.SetEventCallback([this](Event e) { OnEvent(e); });
+
+	if (m_Specification.Scenarios.empty())
+	{
+		for (std::string_view name : Scenario::GetNames())
+			m_Specification.Scenarios.emplace_back(name);
+	}
+}
+
+BenchmarkApp::~BenchmarkApp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Methods
+////////////////////////////////////////////////////////////////////////////////////
+BenchmarkReport BenchmarkApp::Run()
+{
+	BenchmarkReport report = {};
+	report.Frames = m_Specification.Frames;
+	report.WarmupFrames = m_Specification.WarmupFrames;
+	report.Width = m_Specification.Width;
+	report.Height = m_Specification.Height;
+	report.Headless = m_Specification.Headless;
+
+	for (const auto& name : m_Specification.Scenarios)
+	{
+		if (!m_Running)
+			break;
+
+		// Note: Every scenario gets fresh resources, which are destroyed before the next one starts
+		std::unique_ptr<Scenario> scenario = Scenario::Create(name);
+		scenario->Init(m_Window, m_Specification.ScenarioSpecs);
+
+		report.Scenarios.push_back(RunScenario(*scenario));
+
+		// Note: Scenarios may have resized the window
+		if (m_Window.GetSize() != Vec2<uint32_t>(m_Specification.Width, m_Specification.Height))
+			m_Window.SetSize(m_Specification.Width, m_Specification.Height);
+	}
+
+	return report;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Private methods
+////////////////////////////////////////////////////////////////////////////////////
+ScenarioResult BenchmarkApp::RunScenario(Scenario& scenario)
+{
+	ScenarioResult result = {};
+	result.Name = scenario.GetName();
+	result.Count = m_Specification.ScenarioSpecs.Count;
+
+	// Note: Timings are enabled during the warmup so every phase is known and can be reserved up front
+	Lunar::Internal::Timings::Enable(true);
+	for (uint32_t i = 0; i < m_Specification.WarmupFrames && m_Running; i++)
+		RenderFrame(scenario, i);
+
+	(void)Lunar::Internal::Timings::Collect();
+	Lunar::Internal::Timings::Reserve(m_Specification.Frames);
+
+	std::vector<double> frameTimes;
+	frameTimes.reserve(m_Specification.Frames);
+	std::vector<Lunar::FrameStats> frameStats;
+	frameStats.reserve(m_Specification.Frames);
+
+	std::unordered_map<std::string, std::vector<double>> gpuPhases;
+	std::unordered_map<std::string, double> gpuFrame;
+
+	// Note: Only the allocations made inside RenderFrame are counted, the bookkeeping below is excluded
+	Allocations::Counters allocations = {};
+
+	for (uint32_t i = 0; i < m_Specification.Frames && m_Running; i++)
+	{
+		const Allocations::Counters before = Allocations::Get();
+		const auto start = std::chrono::steady_clock::now();
+		RenderFrame(scenario, m_Specification.WarmupFrames + i);
+		const auto end = std::chrono::steady_clock::now();
+		const Allocations::Counters after = Allocations::Get();
+
+		allocations.Count += after.Count - before.Count;
+		allocations.Bytes += after.Bytes - before.Bytes;
+		frameTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+
+		// Note: These belong to an earlier frame, the ones of the last frames in flight are never read
+		gpuFrame.clear();
+		for (const auto& zone : m_Window.GetRenderer().GetGPUTimings())
+			gpuFrame[zone.Name] += zone.Duration;
+		for (const auto& [name, duration] : gpuFrame)
+			gpuPhases[name].push_back(duration);
+
+		// Note: Of the previous frame, the counters are swapped in BeginFrame
+		if (i > 0)
+			frameStats.push_back(m_Window.GetRenderer().GetFrameStats());
+	}
+
+	Lunar::Internal::Timings::Enable(false);
+
+	result.FrameMilliseconds = Statistics::From(std::move(frameTimes));
+	result.Allocations = allocations.Count;
+	result.AllocatedBytes = allocations.Bytes;
+
+	for (auto& [phase, durations] : Lunar::Internal::Timings::Collect())
+		result.Phases.push_back({ phase, Statistics::From(std::move(durations)) });
+	std::sort(result.Phases.begin(), result.Phases.end(), [](const PhaseResult& a, const PhaseResult& b) { return a.Name < b.Name; });
+
+	for (auto& [phase, durations] : gpuPhases)
+		result.GPUPhases.push_back({ phase, Statistics::From(std::move(durations)) });
+	std::sort(result.GPUPhases.begin(), result.GPUPhases.end(), [](const PhaseResult& a, const PhaseResult& b) { return a.Name < b.Name; });
+
+	auto counter = [&frameStats](const char* name, uint64_t Lunar::FrameStats::* member) -> CounterResult
+	{
+		std::vector<double> values;
+		values.reserve(frameStats.size());
+		for (const auto& stats : frameStats)
+			values.push_back(static_cast<double>(stats.*member));
+		return { name, Statistics::From(std::move(values)) };
+	};
+	result.FrameStats = {
+		counter("draw_calls", &Lunar::FrameStats::DrawCalls),
+		counter("indices", &Lunar::FrameStats::Indices),
+		counter("quads", &Lunar::FrameStats::Quads),
+		counter("vertex_bytes", &Lunar::FrameStats::VertexBytes),
+		counter("staging_allocations", &Lunar::FrameStats::StagingAllocations),
+		counter("descriptor_writes", &Lunar::FrameStats::DescriptorWrites),
+		counter("submits", &Lunar::FrameStats::Submits),
+		counter("barriers", &Lunar::FrameStats::Barriers),
+		counter("pipeline_binds", &Lunar::FrameStats::PipelineBinds),
+	};
+
+	return result;
+}
+
+void BenchmarkApp::RenderFrame(Scenario& scenario, uint32_t frame)
+{
+	m_Window.PollEvents();
+	scenario.Update(m_Window, frame);
+
+	m_Window.GetRenderer().BeginFrame();
+
+	scenario.Render(m_Window, frame);
+
+	m_Window.GetRenderer().EndFrame();
+	m_Window.SwapBuffers();
+}
+
+void BenchmarkApp::OnEvent(Event event)
+{
+	EventHandler handler(event);
+
+	// Note: Passes are resized by the renderer itself
+	handler.Handle<WindowCloseEvent>([this](WindowCloseEvent&)
+	{
+		m_Running = false;
+	});
+}
\ No newline at end of file
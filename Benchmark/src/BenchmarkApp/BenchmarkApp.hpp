@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Lunar/Core/Window.hpp"
+
+#include "BenchmarkApp/Report.hpp"
+#include "BenchmarkApp/Scenarios.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace Lunar;
+
+////////////////////////////////////////////////////////////////////////////////////
+// BenchmarkSpecification
+////////////////////////////////////////////////////////////////////////////////////
+struct BenchmarkSpecification
+{
+public:
+	uint32_t Frames = 1000;
+	uint32_t WarmupFrames = 60; // Note: Not measured, lets pipelines, descriptor sets & pools settle
+	uint32_t Width = 1280, Height = 720;
+
+	bool Headless = true;
+
+	std::vector<std::string> Scenarios = { }; // Note: Empty runs all scenarios
+	ScenarioSpecification ScenarioSpecs = {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+// BenchmarkApp
+////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkApp
+{
+public:
+	// Constructor & Destructor
+	BenchmarkApp(const BenchmarkSpecification& specs);
+	~BenchmarkApp();
+
+	// Methods
+	BenchmarkReport Run();
+
+private:
+	// Private methods
+	ScenarioResult RunScenario(Scenario& scenario);
+	void RenderFrame(Scenario& scenario, uint32_t frame);
+
+	void OnEvent(Event event);
+
+private:
+	BenchmarkSpecification m_Specification;
+
+	Window m_Window = {};
+	bool m_Running = true;
+};
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "Report.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+
+namespace
+{
+	static void WriteString(std::ostream& out, const std::string& str)
+	{
+		out << '"';
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\')
+				out << '\\';
+			out << c;
+		}
+		out << '"';
+	}
+
+	static void WriteStatistics(std::ostream& out, const Statistics& stats)
+	{
+		out << "{ \"samples\": " << stats.Samples
+			<< ", \"total\": " << stats.Total
+			<< ", \"mean\": " << stats.Mean
+			<< ", \"min\": " << stats.Min
+			<< ", \"p50\": " << stats.P50
+			<< ", \"p90\": " << stats.P90
+			<< ", \"p99\": " << stats.P99
+			<< ", \"max\": " << stats.Max << " }";
+	}
+
+	template<typename TResult>
+	static void WriteSection(std::ostream& out, const char* key, const std::vector<TResult>& results, Statistics TResult::* statistics)
+	{
+		out << "      \"" << key << "\": {";
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			out << ((i == 0) ? "\n" : ",\n") << "        ";
+			WriteString(out, results[i].Name);
+			out << ": ";
+			WriteStatistics(out, results[i].*statistics);
+		}
+		out << (results.empty() ? "},\n" : "\n      },\n");
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Statistics
+////////////////////////////////////////////////////////////////////////////////////
+Statistics Statistics::From(std::vector<double> values)
+{
+	Statistics stats = {};
+	if (values.empty())
+		return stats;
+
+	std::sort(values.begin(), values.end());
+
+	auto percentile = [&values](double p) -> double
+	{
+		const size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(values.size())));
+		return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+	};
+
+	stats.Samples = values.size();
+	stats.Total = std::accumulate(values.begin(), values.end(), 0.0);
+	stats.Mean = stats.Total / static_cast<double>(values.size());
+	stats.Min = values.front();
+	stats.P50 = percentile(0.50);
+	stats.P90 = percentile(0.90);
+	stats.P99 = percentile(0.99);
+	stats.Max = values.back();
+	return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// BenchmarkReport
+////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkReport::WriteJSON(std::ostream& out) const
+{
+	// Note: All durations are CPU milliseconds, except for the GPU phases. The frame stats are counts
+	out << "{\n";
+	out << "  \"frames\": " << Frames << ",\n";
+	out << "  \"warmup_frames\": " << WarmupFrames << ",\n";
+	out << "  \"width\": " << Width << ",\n";
+	out << "  \"height\": " << Height << ",\n";
+	out << "  \"headless\": " << (Headless ? "true" : "false") << ",\n";
+	out << "  \"scenarios\": [\n";
+
+	for (size_t i = 0; i < Scenarios.size(); i++)
+	{
+		const ScenarioResult& scenario = Scenarios[i];
+
+		out << "    {\n";
+		out << "      \"name\": "; WriteString(out, scenario.Name); out << ",\n";
+		out << "      \"count\": " << scenario.Count << ",\n";
+		out << "      \"frame_ms\": "; WriteStatistics(out, scenario.FrameMilliseconds); out << ",\n";
+
+		WriteSection(out, "phases_ms", scenario.Phases, &PhaseResult::Milliseconds);
+		WriteSection(out, "gpu_phases_ms", scenario.GPUPhases, &PhaseResult::Milliseconds);
+		WriteSection(out, "frame_stats", scenario.FrameStats, &CounterResult::Values);
+
+		out << "      \"allocations\": { \"count\": " << scenario.Allocations
+			<< ", \"bytes\": " << scenario.AllocatedBytes
+			<< ", \"per_frame\": " << ((Frames > 0) ? (static_cast<double>(scenario.Allocations) / static_cast<double>(Frames)) : 0.0) << " }\n";
+
+		out << "    }" << ((i + 1 < Scenarios.size()) ? ",\n" : "\n");
+	}
+
+	out << "  ]\n";
+	out << "}\n";
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <ostream>
+
+////////////////////////////////////////////////////////////////////////////////////
+// Statistics
+////////////////////////////////////////////////////////////////////////////////////
+struct Statistics
+{
+public:
+	uint64_t Samples = 0;
+	double Total = 0.0, Mean = 0.0;
+	double Min = 0.0, P50 = 0.0, P90 = 0.0, P99 = 0.0, Max = 0.0;
+
+public:
+	static Statistics From(std::vector<double> values); // Note: Percentiles use the nearest rank
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+// Results
+////////////////////////////////////////////////////////////////////////////////////
+struct PhaseResult
+{
+public:
+	std::string Name = {};
+	Statistics Milliseconds = {};
+};
+
+struct CounterResult
+{
+public:
+	std::string Name = {};
+	Statistics Values = {}; // Note: Per frame
+};
+
+struct ScenarioResult
+{
+public:
+	std::string Name = {};
+	uint32_t Count = 0;
+
+	Statistics FrameMilliseconds = {}; // Note: From BeginFrame up to & including SwapBuffers
+	std::vector<PhaseResult> Phases = { };
+	std::vector<PhaseResult> GPUPhases = { }; // Note: Summed per frame over all zones with the same name
+	std::vector<CounterResult> FrameStats = { };
+
+	uint64_t Allocations = 0;
+	uint64_t AllocatedBytes = 0;
+};
+
+struct BenchmarkReport
+{
+public:
+	uint32_t Frames = 0, WarmupFrames = 0;
+	uint32_t Width = 0, Height = 0;
+	bool Headless = false;
+
+	std::vector<ScenarioResult> Scenarios = { };
+
+public:
+	void WriteJSON(std::ostream& out) const;
+};
\ No newline at end of file
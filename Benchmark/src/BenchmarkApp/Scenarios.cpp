@@ -0,0 +1,223 @@
+#include "Scenarios.hpp"
+
+#include "Lunar/Maths/Functions.hpp"
+
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	static constexpr const uint32_t s_MaxQuads = Renderpass2DRendererType::MaxQuads;
+	static constexpr const uint32_t s_MaxTextures = Renderpass2DRendererType::MaxTextures - 2u; // Note: The white texture takes a slot & the last one is reserved
+
+	static constexpr const uint32_t s_TextureSize = 4u;
+	static constexpr const uint32_t s_StreamingSlots = 8u;
+
+	// Note: Lays out count quads in a square grid covering [0, 1] (see SetCamera)
+	template<typename TDrawFn>
+	static void DrawGrid(uint32_t count, TDrawFn&& draw)
+	{
+		const uint32_t columns = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(std::max(count, 1u)))));
+		const float size = 1.0f / static_cast<float>(columns);
+
+		for (uint32_t i = 0; i < count; i++)
+			draw(i, Vec3<float>(static_cast<float>(i % columns) * size, static_cast<float>(i / columns) * size, 0.0f), Vec2<float>(size, size));
+	}
+
+	static void SetCamera(Renderpass2D& pass)
+	{
+		pass.Set2DCamera(Mat4(1.0f), Maths::Orthographic(0.0f, 1.0f, 0.0f, 1.0f));
+	}
+
+	static void FillTexture(Texture& texture, std::vector<uint8_t>& pixels, uint32_t size, uint32_t seed)
+	{
+		pixels.resize(static_cast<size_t>(size) * size * 4u);
+		for (size_t i = 0; i < pixels.size(); i += 4)
+		{
+			pixels[i + 0] = static_cast<uint8_t>(seed * 37u);
+			pixels[i + 1] = static_cast<uint8_t>(seed * 91u + i);
+			pixels[i + 2] = static_cast<uint8_t>(seed * 13u);
+			pixels[i + 3] = 255u;
+		}
+
+		texture.SetData(pixels.data(), pixels.size());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Static methods
+////////////////////////////////////////////////////////////////////////////////////
+std::vector<std::string_view> Scenario::GetNames()
+{
+	return { "quads", "unique_textures", "many_passes", "resize_storm", "texture_streaming" };
+}
+
+std::unique_ptr<Scenario> Scenario::Create(std::string_view name)
+{
+	if (name == "quads")				return std::make_unique<QuadsScenario>();
+	if (name == "unique_textures")		return std::make_unique<UniqueTexturesScenario>();
+	if (name == "many_passes")			return std::make_unique<ManyPassesScenario>();
+	if (name == "resize_storm")			return std::make_unique<ResizeStormScenario>();
+	if (name == "texture_streaming")	return std::make_unique<TextureStreamingScenario>();
+
+	return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// QuadsScenario
+////////////////////////////////////////////////////////////////////////////////////
+void QuadsScenario::Init(Window& window, const ScenarioSpecification& specs)
+{
+	m_Pass.Init(window.GetRenderer().GetID(), LoadOperation::Clear);
+	m_Count = std::min(specs.Count, s_MaxQuads);
+
+	std::vector<uint8_t> pixels;
+	m_Texture.Init(window.GetRenderer().GetID(), s_TextureSize, s_TextureSize);
+	FillTexture(m_Texture, pixels, s_TextureSize, 1u);
+}
+
+void QuadsScenario::Render(Window&, uint32_t)
+{
+	m_Pass.Begin();
+	SetCamera(m_Pass);
+
+	DrawGrid(m_Count, [this](uint32_t, const Vec3<float>& position, const Vec2<float>& size) { m_Pass.DrawQuad(position, size, m_Texture); });
+
+	m_Pass.End();
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// UniqueTexturesScenario
+////////////////////////////////////////////////////////////////////////////////////
+void UniqueTexturesScenario::Init(Window& window, const ScenarioSpecification& specs)
+{
+	m_Pass.Init(window.GetRenderer().GetID(), LoadOperation::Clear);
+
+	std::vector<uint8_t> pixels;
+	m_Textures.resize(std::min(specs.Count, s_MaxTextures));
+	for (uint32_t i = 0; i < m_Textures.size(); i++)
+	{
+		m_Textures[i] = std::make_unique<Texture>(window.GetRenderer().GetID(), s_TextureSize, s_TextureSize);
+		FillTexture(*m_Textures[i], pixels, s_TextureSize, i);
+	}
+}
+
+void UniqueTexturesScenario::Render(Window&, uint32_t)
+{
+	m_Pass.Begin();
+	SetCamera(m_Pass);
+
+	DrawGrid(static_cast<uint32_t>(m_Textures.size()), [this](uint32_t index, const Vec3<float>& position, const Vec2<float>& size) { m_Pass.DrawQuad(position, size, *m_Textures[index]); });
+
+	m_Pass.End();
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// ManyPassesScenario
+////////////////////////////////////////////////////////////////////////////////////
+void ManyPassesScenario::Init(Window& window, const ScenarioSpecification& specs)
+{
+	// Note: Every pass after the first loads the previous contents, so all passes contribute to the frame
+	m_Passes.resize(std::clamp(specs.Count / 100u, 1u, 256u));
+	for (size_t i = 0; i < m_Passes.size(); i++)
+		m_Passes[i] = std::make_unique<Renderpass2D>(window.GetRenderer().GetID(), ((i == 0) ? LoadOperation::Clear : LoadOperation::Load));
+}
+
+void ManyPassesScenario::Render(Window&, uint32_t)
+{
+	const uint32_t passCount = static_cast<uint32_t>(m_Passes.size());
+	for (uint32_t i = 0; i < passCount; i++)
+	{
+		Renderpass2D& pass = *m_Passes[i];
+
+		pass.Begin();
+		SetCamera(pass);
+
+		DrawGrid(passCount * 4u, [&pass, i](uint32_t index, const Vec3<float>& position, const Vec2<float>& size)
+		{
+			if ((index % 4u) == (i % 4u))
+				pass.DrawQuad(position, size, { 1.0f, 0.5f, 0.25f, 1.0f });
+		});
+
+		pass.End();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// ResizeStormScenario
+////////////////////////////////////////////////////////////////////////////////////
+void ResizeStormScenario::Init(Window& window, const ScenarioSpecification&)
+{
+	m_Pass.Init(window.GetRenderer().GetID(), LoadOperation::Clear);
+	m_BaseSize = window.GetSize();
+}
+
+void ResizeStormScenario::Update(Window& window, uint32_t frame)
+{
+	// Note: Cycles through a few sizes around the original size
+	static constexpr const std::array<float, 4> s_Scales = { 0.5f, 0.75f, 1.25f, 1.0f };
+	const float scale = s_Scales[frame % s_Scales.size()];
+	window.SetSize(static_cast<uint32_t>(static_cast<float>(m_BaseSize.x) * scale), static_cast<uint32_t>(static_cast<float>(m_BaseSize.y) * scale));
+}
+
+void ResizeStormScenario::Render(Window&, uint32_t)
+{
+	m_Pass.Begin();
+	SetCamera(m_Pass);
+
+	DrawGrid(64u, [this](uint32_t, const Vec3<float>& position, const Vec2<float>& size) { m_Pass.DrawQuad(position, size, { 0.25f, 0.5f, 1.0f, 1.0f }); });
+
+	m_Pass.End();
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// TextureStreamingScenario
+////////////////////////////////////////////////////////////////////////////////////
+void TextureStreamingScenario::Init(Window& window, const ScenarioSpecification& specs)
+{
+	m_Pass.Init(window.GetRenderer().GetID(), LoadOperation::Clear);
+
+	std::error_code error;
+	if (std::filesystem::is_directory(specs.ImageDirectory, error))
+	{
+		for (const auto& entry : std::filesystem::directory_iterator(specs.ImageDirectory, error))
+		{
+			if (entry.is_regular_file())
+				m_Images.push_back(entry.path());
+		}
+		std::sort(m_Images.begin(), m_Images.end());
+	}
+
+	m_Textures.resize(s_StreamingSlots);
+	for (auto& texture : m_Textures)
+	{
+		texture = std::make_unique<Texture>(window.GetRenderer().GetID(), s_TextureSize, s_TextureSize);
+		FillTexture(*texture, m_Pixels, s_TextureSize, 0u);
+	}
+}
+
+void TextureStreamingScenario::Render(Window& window, uint32_t frame)
+{
+	// Note: The replaced texture is destroyed through the deletion queue, so this also measures deferred destruction
+	const uint32_t slot = frame % s_StreamingSlots;
+	m_Textures[slot] = std::make_unique<Texture>();
+
+	if (!m_Images.empty())
+	{
+		m_Textures[slot]->LoadAsync(window.GetRenderer().GetID(), m_Images[frame % m_Images.size()]);
+	}
+	else
+	{
+		static constexpr const uint32_t s_StreamedSize = 256u;
+		m_Textures[slot]->Init(window.GetRenderer().GetID(), s_StreamedSize, s_StreamedSize);
+		FillTexture(*m_Textures[slot], m_Pixels, s_StreamedSize, frame);
+	}
+
+	m_Pass.Begin();
+	SetCamera(m_Pass);
+
+	DrawGrid(s_StreamingSlots, [this](uint32_t index, const Vec3<float>& position, const Vec2<float>& size) { m_Pass.DrawQuad(position, size, *m_Textures[index]); });
+
+	m_Pass.End();
+}
\ No newline at end of file
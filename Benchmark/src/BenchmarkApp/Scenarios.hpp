@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Lunar/Core/Window.hpp"
+#include "Lunar/Renderer/Texture.hpp"
+#include "Lunar/Renderer/Renderpass.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <string_view>
+#include <filesystem>
+
+using namespace Lunar;
+
+////////////////////////////////////////////////////////////////////////////////////
+// ScenarioSpecification
+////////////////////////////////////////////////////////////////////////////////////
+struct ScenarioSpecification
+{
+public:
+	uint32_t Count = 10000; // Note: Quads, textures or passes depending on the scenario, clamped to what the renderer supports
+	std::filesystem::path ImageDirectory = "../Sandbox/Resources/Images"; // Note: Used by the texture streaming scenario
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+// Scenario
+////////////////////////////////////////////////////////////////////////////////////
+// Note: Update() is called before Renderer::BeginFrame() & Render() between Renderer::BeginFrame() & Renderer::EndFrame(),
+// both with a fixed frame index so every run records exactly the same work.
+class Scenario
+{
+public:
+	// Constructor & Destructor
+	Scenario() = default;
+	virtual ~Scenario() = default;
+
+	// Methods
+	virtual void Init(Window& window, const ScenarioSpecification& specs) = 0;
+	virtual void Update(Window&, uint32_t) {}
+	virtual void Render(Window& window, uint32_t frame) = 0;
+
+	// Getters
+	virtual std::string_view GetName() const = 0;
+
+	// Static methods
+	static std::vector<std::string_view> GetNames();
+	static std::unique_ptr<Scenario> Create(std::string_view name);
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+// Scenarios
+////////////////////////////////////////////////////////////////////////////////////
+class QuadsScenario : public Scenario // Note: Count textured quads sharing one texture
+{
+public:
+	void Init(Window& window, const ScenarioSpecification& specs) override;
+	void Render(Window& window, uint32_t frame) override;
+
+	inline std::string_view GetName() const override { return "quads"; }
+
+private:
+	Renderpass2D m_Pass = {};
+	Texture m_Texture = {};
+	uint32_t m_Count = 0;
+};
+
+class UniqueTexturesScenario : public Scenario // Note: Count quads that all use a different texture
+{
+public:
+	void Init(Window& window, const ScenarioSpecification& specs) override;
+	void Render(Window& window, uint32_t frame) override;
+
+	inline std::string_view GetName() const override { return "unique_textures"; }
+
+private:
+	Renderpass2D m_Pass = {};
+	std::vector<std::unique_ptr<Texture>> m_Textures = { };
+};
+
+class ManyPassesScenario : public Scenario // Note: Count passes with a handful of quads each
+{
+public:
+	void Init(Window& window, const ScenarioSpecification& specs) override;
+	void Render(Window& window, uint32_t frame) override;
+
+	inline std::string_view GetName() const override { return "many_passes"; }
+
+private:
+	std::vector<std::unique_ptr<Renderpass2D>> m_Passes = { };
+};
+
+class ResizeStormScenario : public Scenario // Note: Resizes the window every frame
+{
+public:
+	void Init(Window& window, const ScenarioSpecification& specs) override;
+	void Update(Window& window, uint32_t frame) override;
+	void Render(Window& window, uint32_t frame) override;
+
+	inline std::string_view GetName() const override { return "resize_storm"; }
+
+private:
+	Renderpass2D m_Pass = {};
+	Vec2<uint32_t> m_BaseSize = { 0, 0 };
+};
+
+class TextureStreamingScenario : public Scenario // Note: Replaces a texture every frame through the async loader (or SetData without images)
+{
+public:
+	void Init(Window& window, const ScenarioSpecification& specs) override;
+	void Render(Window& window, uint32_t frame) override;
+
+	inline std::string_view GetName() const override { return "texture_streaming"; }
+
+private:
+	Renderpass2D m_Pass = {};
+
+	std::vector<std::filesystem::path> m_Images = { };
+	std::vector<std::unique_ptr<Texture>> m_Textures = { };
+	std::vector<uint8_t> m_Pixels = { };
+};
\ No newline at end of file
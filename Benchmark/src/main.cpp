@@ -0,0 +1,109 @@
+#include "BenchmarkApp/BenchmarkApp.hpp"
+
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <charconv>
+#include <algorithm>
+#include <string_view>
+
+namespace
+{
+	static void PrintUsage()
+	{
+		std::fputs(
+			"Usage: Benchmark [options]\n"
+			"  --frames <n>        Measured frames per scenario (default 1000)\n"
+			"  --warmup <n>        Unmeasured frames before measuring (default 60)\n"
+			"  --width <n>         Width of the window (default 1280)\n"
+			"  --height <n>        Height of the window (default 720)\n"
+			"  --count <n>         Quads/textures/passes per scenario (default 10000)\n"
+			"  --scenario <name>   Only run this scenario, can be repeated (default all)\n"
+			"  --images <dir>      Images for the texture streaming scenario\n"
+			"  --output <file>     Where to write the JSON report, - for stdout (default benchmark.json)\n"
+			"  --windowed          Render to a window instead of headless\n"
+			"  --list              List the scenarios\n", stderr);
+	}
+
+	static bool ParseUInt(std::string_view str, uint32_t& value)
+	{
+		auto [ptr, error] = std::from_chars(str.data(), str.data() + str.size(), value);
+		return (error == std::errc()) && (ptr == str.data() + str.size());
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkSpecification specs = {};
+	std::string output = "benchmark.json"; // Note: Not stdout by default, since Lunar logs to stdout
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg = argv[i];
+		auto next = [&]() -> std::string_view { return ((i + 1 < argc) ? argv[++i] : ""); };
+
+		bool valid = true;
+		if (arg == "--frames")				valid = ParseUInt(next(), specs.Frames);
+		else if (arg == "--warmup")			valid = ParseUInt(next(), specs.WarmupFrames);
+		else if (arg == "--width")			valid = ParseUInt(next(), specs.Width);
+		else if (arg == "--height")			valid = ParseUInt(next(), specs.Height);
+		else if (arg == "--count")			valid = ParseUInt(next(), specs.ScenarioSpecs.Count);
+		else if (arg == "--scenario")		specs.Scenarios.emplace_back(next());
+		else if (arg == "--images")			specs.ScenarioSpecs.ImageDirectory = next();
+		else if (arg == "--output")			output = next();
+		else if (arg == "--windowed")		specs.Headless = false;
+		else if (arg == "--help")
+		{
+			PrintUsage();
+			return 0;
+		}
+		else if (arg == "--list")
+		{
+			for (std::string_view name : Scenario::GetNames())
+				std::cout << name << '\n';
+			return 0;
+		}
+		else
+			valid = false;
+
+		if (!valid || specs.Width == 0 || specs.Height == 0)
+		{
+			std::cerr << "Invalid argument: " << arg << '\n';
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	const std::vector<std::string_view> names = Scenario::GetNames();
+	for (const auto& name : specs.Scenarios)
+	{
+		if (std::find(names.begin(), names.end(), name) == names.end())
+		{
+			std::cerr << "Unknown scenario: " << name << '\n';
+			return 1;
+		}
+	}
+
+	BenchmarkReport report = {};
+	{
+		BenchmarkApp app(specs);
+		report = app.Run();
+	}
+
+	if (output == "-")
+	{
+		report.WriteJSON(std::cout);
+		return 0;
+	}
+
+	std::ofstream file(output);
+	if (!file.is_open())
+	{
+		std::cerr << "Failed to open " << output << '\n';
+		return 1;
+	}
+
+	report.WriteJSON(file);
+	return 0;
+}
\ No newline at end of file
@@ -28,11 +28,13 @@ namespace Lunar
 			.Title = specs.Title,
 			.Width = specs.Width,
 			.Height = specs.Height,
+			.Headless = specs.Headless,
 			
 			.EventCallback = [this](Internal::Event e) { OnEvent(e); },
 			
 			.VSync = specs.VSync,
 			.Buffers = Internal::WindowSpecification::BufferMode::Triple,
+			.DeferredSubmission = true,
 		});
 
 		m_Renderer.Init(m_Window.GetRenderer().GetID());
@@ -25,6 +25,7 @@ namespace Lunar
 		uint32_t Width = 0, Height = 0;
 
 		bool VSync = false;
+		bool Headless = false; // Note: Renders offscreen without a surface (e.g. for benchmarks on lavapipe), use Renderer::Readback() to get the frames
 	};
 
 	using EventCallbackFn = std::function<void(Event event)>;
@@ -49,6 +50,7 @@ namespace Lunar
 
 		// Setters
 		inline void SetEventCallback(const EventCallbackFn& callback) { m_EventCallback = callback; }
+		inline void SetSize(uint32_t width, uint32_t height) { m_Window.SetSize(width, height); }
 
 		// Getters
 		inline double GetTime() const { return m_Window.GetTime(); }
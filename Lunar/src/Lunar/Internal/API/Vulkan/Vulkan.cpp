@@ -34,15 +34,16 @@ namespace Lunar::Internal
 
 		VKAPI_ATTR VkBool32 VKAPI_CALL VulkanDebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void*)
 		{
+			// Note: Repeated messages (by id) are collapsed, a validation message every frame would otherwise stall the frame
 			if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT)
 			{
 				// Note for future: Make sure to check if the vkQueuePresentKHR is NOT waiting on the imageAvailable semaphore, as it will cause a deadlock and many errors.
-				LU_LOG_ERROR("Validation Error: {0}", pCallbackData->pMessage);
+				LU_LOG_LIMITED_KEY(Error, Vulkan, pCallbackData->messageIdNumber, "Validation Error: {0}", pCallbackData->pMessage);
 				return VK_TRUE;
 			}
 			else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT)
 			{
-				LU_LOG_WARN("Validation Warning: {0}", pCallbackData->pMessage);
+				LU_LOG_LIMITED_KEY(Warn, Vulkan, pCallbackData->messageIdNumber, "Validation Warning: {0}", pCallbackData->pMessage);
 				return VK_FALSE;
 			}
 
@@ -83,13 +84,9 @@ namespace Lunar::Internal
 	VulkanCommand::VulkanCommand(RendererID renderer, bool start)
 		: m_Renderer(renderer)
 	{
-		VkCommandBufferAllocateInfo allocInfo = {};
-		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		allocInfo.commandPool = VulkanRenderer::GetRenderer(m_Renderer).GetVulkanSwapChain().GetVkCommandPool();
-		allocInfo.commandBufferCount = 1;
-
-		VK_VERIFY(vkAllocateCommandBuffers(VulkanContext::GetVulkanDevice().GetVkDevice(), &allocInfo, &m_CommandBuffer));
+		auto entry = VulkanRenderer::GetRenderer(m_Renderer).GetTransientCommandPool().Borrow();
+		m_CommandBuffer = entry.CommandBuffer;
+		m_Fence = entry.Fence;
 
 		if (start)
 			Begin();
@@ -97,7 +94,7 @@ namespace Lunar::Internal
 
 	VulkanCommand::~VulkanCommand()
 	{
-		vkFreeCommandBuffers(VulkanContext::GetVulkanDevice().GetVkDevice(), VulkanRenderer::GetRenderer(m_Renderer).GetVulkanSwapChain().GetVkCommandPool(), 1, &m_CommandBuffer);
+		VulkanRenderer::GetRenderer(m_Renderer).GetTransientCommandPool().Return({ m_CommandBuffer, m_Fence });
 	}
 
 	void VulkanCommand::Begin()
@@ -121,9 +118,11 @@ namespace Lunar::Internal
 		submitInfo.commandBufferCount = 1;
 		submitInfo.pCommandBuffers = &m_CommandBuffer;
 
+		// Note: Only wait for this command, not for everything else on the queue
 		auto queue = VulkanContext::GetVulkanDevice().GetGraphicsQueue();
-		vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
-		vkQueueWaitIdle(queue);
+		vkQueueSubmit(queue, 1, &submitInfo, m_Fence);
+		VulkanRenderer::GetRenderer(m_Renderer).AddFrameStat(FrameStat::Submits);
+		vkWaitForFences(VulkanContext::GetVulkanDevice().GetVkDevice(), 1, &m_Fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
 	}
 
 	void VulkanCommand::EndAndSubmit()
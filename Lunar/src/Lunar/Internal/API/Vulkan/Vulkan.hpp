@@ -198,6 +198,7 @@ namespace Lunar::Internal
     private:
         const RendererID m_Renderer;
         VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+        VkFence m_Fence = VK_NULL_HANDLE;
     };
 
 }
\ No newline at end of file
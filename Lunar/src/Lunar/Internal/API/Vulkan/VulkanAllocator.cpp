@@ -5,6 +5,7 @@
 #include "Lunar/Internal/Utils/Settings.hpp"
 
 #include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanRenderer.hpp"
 
 #if defined(LU_COMPILER_GCC)
     #pragma GCC diagnostic push
@@ -91,7 +92,7 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Buffers
     ////////////////////////////////////////////////////////////////////////////////////
-    VmaAllocation VulkanAllocator::AllocateBuffer(const RendererID, VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage, VkBuffer& dstBuffer, VkMemoryPropertyFlags requiredFlags)
+    VmaAllocation VulkanAllocator::AllocateBuffer(const RendererID renderer, VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage, VkBuffer& dstBuffer, VkMemoryPropertyFlags requiredFlags)
     {
         VkBufferCreateInfo bufferInfo = {};
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -106,6 +107,10 @@ namespace Lunar::Internal
         VmaAllocation allocation = VK_NULL_HANDLE;
         VK_VERIFY(vmaCreateBuffer(s_Allocator, &bufferInfo, &allocInfo, &dstBuffer, &allocation, nullptr));
 
+        // Note: Staging buffers are the only ones that are purely used for transfers
+        if (usage == VK_BUFFER_USAGE_TRANSFER_SRC_BIT || usage == VK_BUFFER_USAGE_TRANSFER_DST_BIT)
+            VulkanRenderer::GetRenderer(renderer).AddFrameStat(FrameStat::StagingAllocations);
+
         return allocation;
     }
 
@@ -5,6 +5,8 @@
 #include "Lunar/Internal/Utils/Profiler.hpp"
 #include "Lunar/Internal/Utils/Settings.hpp"
 
+#include "Lunar/Internal/Memory/ScratchAllocator.hpp"
+
 #include "Lunar/Internal/Renderer/Buffers.hpp"
 #include "Lunar/Internal/Renderer/Renderer.hpp"
 
@@ -30,11 +32,7 @@ namespace Lunar::Internal
 
 	void VulkanVertexBuffer::Destroy(const RendererID renderer)
 	{
-		Renderer::GetRenderer(renderer).Free([rendererID = renderer, buffer = m_Buffer, allocation = m_Allocation]()
-		{
-			if (buffer != VK_NULL_HANDLE)
-				VulkanAllocator::DestroyBuffer(rendererID, buffer, allocation);
-		});
+		VulkanRenderer::GetRenderer(renderer).Free(m_Buffer, m_Allocation);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +64,8 @@ namespace Lunar::Internal
 		// Copy data from the staging buffer to the vertex buffer at the specified offset
 		VulkanAllocator::CopyBuffer(renderer, stagingBuffer, m_Buffer, size, offset);
 		VulkanAllocator::DestroyBuffer(renderer, stagingBuffer, stagingBufferAllocation);
+
+		VulkanRenderer::GetRenderer(renderer).AddFrameStat(FrameStat::VertexBytes, size);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -76,10 +76,10 @@ namespace Lunar::Internal
 		LU_PROFILE("VkVertexBuffer::Bind(Buffers)");
 		VulkanCommandBuffer& vkCmdBuf = commandBuffer.GetInternalCommandBuffer();
 
-		std::vector<VkBuffer> vkBuffers;
+		std::pmr::vector<VkBuffer> vkBuffers(ScratchAllocator::Get());
 		vkBuffers.reserve(buffers.size());
 
-		std::vector<VkDeviceSize> offsets(buffers.size(), 0);
+		std::pmr::vector<VkDeviceSize> offsets(buffers.size(), 0, ScratchAllocator::Get());
 
 		for (auto& buffer : buffers)
 		{
@@ -100,7 +100,7 @@ namespace Lunar::Internal
 		VkDeviceSize bufferSize = sizeof(uint8_t) * count;
 
 		#if defined(LU_PLATFORM_APPLE)
-		LU_LOG_WARN("[VkIndexBuffer] Index buffer of type UInt8 is not supported on apple. Converting to UInt16.");
+		LU_LOG_CAT(Warn, Vulkan, "[VkIndexBuffer] Index buffer of type UInt8 is not supported on apple. Converting to UInt16.");
 
 		m_Type = Type::UInt16;
 
@@ -144,11 +144,7 @@ namespace Lunar::Internal
 
 	void VulkanIndexBuffer::Destroy(const RendererID renderer)
 	{
-		Renderer::GetRenderer(renderer).Free([renderer = renderer, buffer = m_Buffer, allocation = m_Allocation]()
-		{
-			if (buffer != VK_NULL_HANDLE)
-				VulkanAllocator::DestroyBuffer(renderer, buffer, allocation);
-		});
+		VulkanRenderer::GetRenderer(renderer).Free(m_Buffer, m_Allocation);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -217,7 +213,7 @@ namespace Lunar::Internal
 		#if defined(LU_CONFIG_DEBUG)
 			if (specs.Usage == BufferMemoryUsage::GPU)
 			{
-				LU_LOG_WARN("[VkUniformBuffer] Creating a UniformBuffer solely on the GPU. This means SetData() cannot be used. Was this intented? If not, use: CPUToGPU.");
+				LU_LOG_CAT(Warn, Vulkan, "[VkUniformBuffer] Creating a UniformBuffer solely on the GPU. This means SetData() cannot be used. Was this intented? If not, use: CPUToGPU.");
 			}
 		#endif
 
@@ -231,14 +227,8 @@ namespace Lunar::Internal
 
 	void VulkanUniformBuffer::Destroy(const RendererID renderer)
 	{
-		Renderer::GetRenderer(renderer).Free([renderer = renderer, buffers = m_Buffers, allocations = m_Allocations]()
-		{
-			for (size_t i = 0; i < buffers.size(); i++)
-			{
-				if (buffers[i] != VK_NULL_HANDLE)
-					VulkanAllocator::DestroyBuffer(renderer, buffers[i], allocations[i]);
-			}
-		});
+		for (size_t i = 0; i < m_Buffers.size(); i++)
+			VulkanRenderer::GetRenderer(renderer).Free(m_Buffers[i], m_Allocations[i]);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -268,7 +258,7 @@ namespace Lunar::Internal
 		#if defined(LU_CONFIG_DEBUG)
 			if (specs.Usage == BufferMemoryUsage::GPU)
 			{
-				LU_LOG_WARN("[VkStorageBuffer] Creating a StorageBuffer solely on the GPU. This means SetData() cannot be used. Was this intented? If not, use: CPUToGPU.");
+				LU_LOG_CAT(Warn, Vulkan, "[VkStorageBuffer] Creating a StorageBuffer solely on the GPU. This means SetData() cannot be used. Was this intented? If not, use: CPUToGPU.");
 			}
 		#endif
 
@@ -282,14 +272,8 @@ namespace Lunar::Internal
 
 	void VulkanStorageBuffer::Destroy(const RendererID renderer)
 	{
-		Renderer::GetRenderer(renderer).Free([renderer = renderer, buffers = m_Buffers, allocations = m_Allocations]()
-		{
-			for (size_t i = 0; i < buffers.size(); i++)
-			{
-				if (buffers[i] != VK_NULL_HANDLE)
-					VulkanAllocator::DestroyBuffer(renderer, buffers[i], allocations[i]);
-			}
-		});
+		for (size_t i = 0; i < m_Buffers.size(); i++)
+			VulkanRenderer::GetRenderer(renderer).Free(m_Buffers[i], m_Allocations[i]);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -13,19 +13,18 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Init & Destroy
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanCommandBuffer::Init(const RendererID renderer)
+    void VulkanCommandBuffer::Init(const RendererID renderer, CommandBufferLevel level)
     {
+        m_Level = level;
+
         VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
         const uint32_t framesInFlight = static_cast<uint32_t>(Renderer::GetRenderer(renderer).GetSpecification().Buffers);
-        m_CommandBuffers.resize(framesInFlight);
 
-        VkCommandBufferAllocateInfo allocInfo = {};
-        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.commandPool = VulkanRenderer::GetRenderer(renderer).GetVulkanSwapChain().GetVkCommandPool();
-        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandBufferCount = static_cast<uint32_t>(m_CommandBuffers.size());
+        // Note: The command buffers themselves are acquired from the renderer's command pools in Renderer::Begin
+        m_CommandBuffers.resize(framesInFlight, VK_NULL_HANDLE);
 
-        VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, m_CommandBuffers.data()));
+        if (m_Level == CommandBufferLevel::Secondary)
+            return;
 
         m_RenderFinishedSemaphores.resize(framesInFlight);
         m_InFlightFences.resize(framesInFlight);
@@ -46,23 +45,11 @@ namespace Lunar::Internal
 
     void VulkanCommandBuffer::Destroy(const RendererID renderer)
     {
-        Renderer::GetRenderer(renderer).Free([rendererID = renderer, commandBuffers = m_CommandBuffers, renderFinishedSemaphores = m_RenderFinishedSemaphores, inFlightFences = m_InFlightFences]()
+        for (size_t i = 0; i < m_RenderFinishedSemaphores.size(); i++) 
         {
-            VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
-
-            auto& renderer = VulkanRenderer::GetRenderer(rendererID);
-
-            vkFreeCommandBuffers(device, renderer.GetVulkanSwapChain().GetVkCommandPool(), static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
-
-            for (size_t i = 0; i < renderFinishedSemaphores.size(); i++) 
-            {
-                renderer.GetTaskManager().RemoveFromAll(renderFinishedSemaphores[i]);
-                renderer.GetTaskManager().RemoveFromAll(inFlightFences[i]);
-
-                vkDestroySemaphore(device, renderFinishedSemaphores[i], nullptr);
-                vkDestroyFence(device, inFlightFences[i], nullptr);
-            }
-        });
+            VulkanRenderer::GetRenderer(renderer).Free(m_RenderFinishedSemaphores[i]);
+            VulkanRenderer::GetRenderer(renderer).Free(m_InFlightFences[i]);
+        }
     }
 
 }
\ No newline at end of file
@@ -20,20 +20,25 @@ namespace Lunar::Internal
         ~VulkanCommandBuffer() = default;
 
         // Init & Destroy
-		void Init(const RendererID renderer);
+		void Init(const RendererID renderer, CommandBufferLevel level);
         void Destroy(const RendererID renderer);
 
         // The Begin, End & Submit methods are in the Renderer class.
 
         // Getters
+        inline CommandBufferLevel GetLevel() const { return m_Level; }
+
         inline VkSemaphore GetVkRenderFinishedSemaphore(uint32_t index) const { return m_RenderFinishedSemaphores[index]; }
         inline VkFence GetVkInFlightFence(uint32_t index) const { return m_InFlightFences[index]; }
         inline VkCommandBuffer GetVkCommandBuffer(uint32_t index) const { return m_CommandBuffers[index]; }
 
     private:
+        CommandBufferLevel m_Level = CommandBufferLevel::Primary;
+
         std::vector<VkCommandBuffer> m_CommandBuffers = {};
 
         // Synchronization objects
+        // Note: Secondary command buffers are never submitted, so they don't have any
         std::vector<VkSemaphore> m_RenderFinishedSemaphores = {};
         std::vector<VkFence> m_InFlightFences = {};
 
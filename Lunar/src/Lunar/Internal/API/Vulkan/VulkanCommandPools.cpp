@@ -0,0 +1,201 @@
+#include "lupch.h"
+#include "VulkanCommandPools.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
+
+namespace Lunar::Internal
+{
+
+    namespace
+    {
+        static thread_local uint32_t s_RecordingSlot = VulkanCommandPools::NoSlot;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanCommandPools::Init(const RendererID rendererID, uint32_t queueFamily, uint32_t frameCount)
+    {
+        m_RendererID = rendererID;
+        m_QueueFamily = queueFamily;
+        m_FrameCount = frameCount;
+
+        Reserve(1);
+    }
+
+    void VulkanCommandPools::Destroy()
+    {
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        // Note: Destroying the pool also frees all of its command buffers
+        for (auto& slot : m_Pools)
+        {
+            for (auto& pool : slot)
+                vkDestroyCommandPool(device, pool.CommandPool, nullptr);
+        }
+
+        m_Pools.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VkCommandBuffer VulkanCommandPools::Acquire(uint32_t frame, CommandBufferLevel level)
+    {
+        LU_PROFILE("VkCommandPools::Acquire()");
+        const uint32_t slot = GetSlot();
+        LU_ASSERT((slot != NoSlot), "[VkCommandPools] This thread has no recording slot, frame command buffers can only be recorded on the thread calling Renderer::BeginFrame or inside Renderer::Record tasks.");
+        LU_ASSERT((slot < m_Pools.size()), std::format("[VkCommandPools] Recording slot {0} has not been reserved.", slot));
+
+        Pool& pool = m_Pools[slot][frame];
+
+        const bool secondary = (level == CommandBufferLevel::Secondary);
+        std::vector<VkCommandBuffer>& commandBuffers = (secondary ? pool.SecondaryCommandBuffers : pool.CommandBuffers);
+        uint32_t& used = (secondary ? pool.SecondaryUsed : pool.Used);
+
+        if (used == commandBuffers.size())
+        {
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = pool.CommandPool;
+            allocInfo.level = (secondary ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+            allocInfo.commandBufferCount = 1;
+
+            VK_VERIFY(vkAllocateCommandBuffers(VulkanContext::GetVulkanDevice().GetVkDevice(), &allocInfo, &commandBuffers.emplace_back()));
+        }
+
+        return commandBuffers[used++];
+    }
+
+    void VulkanCommandPools::Reset(uint32_t frame)
+    {
+        LU_PROFILE("VkCommandPools::Reset()");
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        for (auto& slot : m_Pools)
+        {
+            Pool& pool = slot[frame];
+            if (pool.Used == 0 && pool.SecondaryUsed == 0)
+                continue;
+
+            VK_VERIFY(vkResetCommandPool(device, pool.CommandPool, 0));
+            pool.Used = 0;
+            pool.SecondaryUsed = 0;
+        }
+    }
+
+    void VulkanCommandPools::Reserve(uint32_t slots)
+    {
+        if (slots <= m_Pools.size())
+            return;
+
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT; // Command buffers are only reused after a pool reset
+        poolInfo.queueFamilyIndex = m_QueueFamily;
+
+        const size_t previous = m_Pools.size();
+        m_Pools.resize(slots);
+
+        for (size_t i = previous; i < m_Pools.size(); i++)
+        {
+            m_Pools[i].resize(m_FrameCount);
+
+            for (auto& pool : m_Pools[i])
+                VK_VERIFY(vkCreateCommandPool(VulkanContext::GetVulkanDevice().GetVkDevice(), &poolInfo, nullptr, &pool.CommandPool));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint32_t VulkanCommandPools::GetSlot()
+    {
+        return s_RecordingSlot;
+    }
+
+    void VulkanCommandPools::SetSlot(uint32_t slot)
+    {
+        s_RecordingSlot = slot;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanTransientCommandPool::Init(uint32_t queueFamily, uint32_t preallocate)
+    {
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // Allows us to reset the command buffer and reuse it.
+        poolInfo.queueFamilyIndex = queueFamily;
+
+        VK_VERIFY(vkCreateCommandPool(VulkanContext::GetVulkanDevice().GetVkDevice(), &poolInfo, nullptr, &m_CommandPool));
+
+        m_Entries.reserve(preallocate);
+        m_Available.reserve(preallocate);
+        for (uint32_t i = 0; i < preallocate; i++)
+            m_Available.push_back(Allocate());
+    }
+
+    void VulkanTransientCommandPool::Destroy()
+    {
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        for (auto& entry : m_Entries)
+            vkDestroyFence(device, entry.Fence, nullptr);
+
+        // Note: Destroying the pool also frees all of its command buffers
+        vkDestroyCommandPool(device, m_CommandPool, nullptr);
+
+        m_Entries.clear();
+        m_Available.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanTransientCommandPool::Entry VulkanTransientCommandPool::Borrow()
+    {
+        if (m_Available.empty())
+            return Allocate();
+
+        Entry entry = m_Available.back();
+        m_Available.pop_back();
+
+        return entry;
+    }
+
+    void VulkanTransientCommandPool::Return(const Entry& entry)
+    {
+        VK_VERIFY(vkResetFences(VulkanContext::GetVulkanDevice().GetVkDevice(), 1, &entry.Fence));
+        m_Available.push_back(entry);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanTransientCommandPool::Entry VulkanTransientCommandPool::Allocate()
+    {
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+        Entry& entry = m_Entries.emplace_back();
+
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = m_CommandPool;
+        allocInfo.commandBufferCount = 1;
+
+        VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, &entry.CommandBuffer));
+
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VK_VERIFY(vkCreateFence(device, &fenceInfo, nullptr, &entry.Fence));
+
+        return entry;
+    }
+
+}
\ No newline at end of file
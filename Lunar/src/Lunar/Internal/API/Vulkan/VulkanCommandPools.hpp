@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <limits>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanCommandPools
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Command pools are not thread-safe, so every recording slot gets its own pool per frame in flight.
+    // Slot 0 is the thread that created the renderer & calls BeginFrame, the other slots belong to Renderer::Record's
+    // workers (one fixed slot per worker thread). Every other thread has NoSlot & can't record frame command buffers.
+    class VulkanCommandPools
+    {
+    public:
+        constexpr static const uint32_t NoSlot = std::numeric_limits<uint32_t>::max();
+    public:
+        // Constructor & Destructor
+        VulkanCommandPools() = default;
+        ~VulkanCommandPools() = default;
+
+        // Init & Destroy
+        void Init(const RendererID rendererID, uint32_t queueFamily, uint32_t frameCount);
+        void Destroy();
+
+        // Methods
+        VkCommandBuffer Acquire(uint32_t frame, CommandBufferLevel level = CommandBufferLevel::Primary); // Returns a command buffer from the current thread's slot, valid until the frame's pools are reset
+        void Reset(uint32_t frame); // Note: Only call once the frame's fences have been signaled
+
+        void Reserve(uint32_t slots); // Note: Not thread-safe, must be called before the slots are used
+
+        // Static methods
+        static uint32_t GetSlot(); // Note: Of the calling thread
+        static void SetSlot(uint32_t slot);
+
+    private:
+        struct Pool
+        {
+        public:
+            VkCommandPool CommandPool = VK_NULL_HANDLE;
+
+            std::vector<VkCommandBuffer> CommandBuffers = { };
+            uint32_t Used = 0;
+
+            std::vector<VkCommandBuffer> SecondaryCommandBuffers = { };
+            uint32_t SecondaryUsed = 0;
+        };
+
+    private:
+        RendererID m_RendererID = 0;
+        uint32_t m_QueueFamily = 0;
+        uint32_t m_FrameCount = 0;
+
+        // The first vector index is the slot, the second is the frame
+        std::vector<std::vector<Pool>> m_Pools = { };
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanTransientCommandPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Backs VulkanCommand, command buffers & fences are borrowed and returned instead of allocated & freed.
+    // Note 2: Not thread-safe, just like the VkCommandPool it wraps.
+    class VulkanTransientCommandPool
+    {
+    public:
+        struct Entry
+        {
+        public:
+            VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+            VkFence Fence = VK_NULL_HANDLE;
+        };
+    public:
+        // Constructor & Destructor
+        VulkanTransientCommandPool() = default;
+        ~VulkanTransientCommandPool() = default;
+
+        // Init & Destroy
+        void Init(uint32_t queueFamily, uint32_t preallocate);
+        void Destroy();
+
+        // Methods
+        Entry Borrow();
+        void Return(const Entry& entry); // Note: The entry's work must have completed (or never been submitted)
+
+    private:
+        // Private methods
+        Entry Allocate();
+
+    private:
+        VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+
+        std::vector<Entry> m_Entries = { }; // All entries, used for destruction
+        std::vector<Entry> m_Available = { };
+    };
+
+}
\ No newline at end of file
@@ -19,9 +19,7 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanContext::Init(void* window)
     {
-        LU_ASSERT(window, "[VulkanContext] No window was attached.");
-
-        InitInstance();
+        InitInstance(window != nullptr);
         InitDevices(window);
 
         VulkanAllocator::Init();
@@ -69,7 +67,7 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanContext::InitInstance()
+    void VulkanContext::InitInstance(bool surfaceSupport)
     {
         ///////////////////////////////////////////////////////////
 		// Instance Creation
@@ -87,10 +85,16 @@ namespace Lunar::Internal
         if constexpr (g_VkValidation)
         {
             if (!validationSupport)
-                LU_LOG_WARN("[VulkanContext] Requested validation layers, but no support found.");
+                LU_LOG_CAT(Warn, Vulkan, "[VulkanContext] Requested validation layers, but no support found.");
         }
 
-		std::vector<const char*> instanceExtensions = { VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_SURFACE_TYPE_NAME };
+		// Note: Headless machines (e.g. lavapipe without a display) may not expose the surface extensions
+		std::vector<const char*> instanceExtensions = { };
+		if (surfaceSupport)
+		{
+			instanceExtensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+			instanceExtensions.push_back(VK_KHR_SURFACE_TYPE_NAME);
+		}
 		if constexpr (g_VkValidation)
 		{
             if (validationSupport)
@@ -175,16 +179,19 @@ namespace Lunar::Internal
 
     void VulkanContext::InitDevices(void* window)
     {
+        // Note: Headless contexts have no surface, the present queue is then the graphics queue
         VkSurfaceKHR surface = VK_NULL_HANDLE;
 
         #if defined(LU_PLATFORM_DESKTOP)
-        VK_VERIFY(glfwCreateWindowSurface(m_Instance, static_cast<GLFWwindow*>(window), nullptr, &surface));
+        if (window)
+            VK_VERIFY(glfwCreateWindowSurface(m_Instance, static_cast<GLFWwindow*>(window), nullptr, &surface));
         #endif
 
 		m_PhysicalDevice.Init(surface);
 		m_Device.Init(surface, m_PhysicalDevice);
 
-        vkDestroySurfaceKHR(m_Instance, surface, nullptr);
+        if (surface)
+            vkDestroySurfaceKHR(m_Instance, surface, nullptr);
     }
 
 }
\ No newline at end of file
@@ -19,7 +19,7 @@ namespace Lunar::Internal
         ~VulkanContext() = default;
 
 		// Init & Destroy
-		void Init(void* window);
+		void Init(void* window); // Note: window may be nullptr for headless rendering
 		void Destroy();
 
         // Static getters
@@ -31,7 +31,7 @@ namespace Lunar::Internal
 
     private:
         // Private methods
-        void InitInstance();
+        void InitInstance(bool surfaceSupport);
         void InitDevices(void* window);
 
 	private:
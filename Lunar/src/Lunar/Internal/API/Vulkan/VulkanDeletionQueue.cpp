@@ -0,0 +1,225 @@
+#include "lupch.h"
+#include "VulkanDeletionQueue.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanRenderer.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanAllocator.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanDeletionQueue::Init(const RendererID rendererID, uint32_t frameCount)
+    {
+        m_RendererID = rendererID;
+        m_FrameCount = frameCount;
+        m_Resources.resize(m_FrameCount);
+    }
+
+    void VulkanDeletionQueue::Destroy()
+    {
+        DrainAll();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Push methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanDeletionQueue::Push(VkBuffer buffer, VmaAllocation allocation)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Buffer;
+        resource.Buffer = buffer;
+        resource.Allocation = allocation;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkImage image, VmaAllocation allocation)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Image;
+        resource.Image = image;
+        resource.Allocation = allocation;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkImageView imageView)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::ImageView;
+        resource.ImageView = imageView;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkSampler sampler)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Sampler;
+        resource.Sampler = sampler;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkFramebuffer framebuffer)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Framebuffer;
+        resource.Framebuffer = framebuffer;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkRenderPass renderpass)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Renderpass;
+        resource.Renderpass = renderpass;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkPipeline pipeline)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Pipeline;
+        resource.Pipeline = pipeline;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkPipelineLayout pipelineLayout)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::PipelineLayout;
+        resource.PipelineLayout = pipelineLayout;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkDescriptorPool descriptorPool)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::DescriptorPool;
+        resource.DescriptorPool = descriptorPool;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkDescriptorSetLayout descriptorSetLayout)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::DescriptorSetLayout;
+        resource.DescriptorSetLayout = descriptorSetLayout;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkShaderModule shaderModule)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::ShaderModule;
+        resource.ShaderModule = shaderModule;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkSemaphore semaphore)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Semaphore;
+        resource.Semaphore = semaphore;
+        Push(resource);
+    }
+
+    void VulkanDeletionQueue::Push(VkFence fence)
+    {
+        Resource resource = {};
+        resource.ResourceType = Type::Fence;
+        resource.Fence = fence;
+        Push(resource);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanDeletionQueue::BeginFrame()
+    {
+        LU_PROFILE("VkDeletionQueue::BeginFrame()");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        m_FrameCounter++;
+
+        // Note: The fences of the frame that last used this slot have been waited on, and every frame
+        // before it has been waited on by an earlier BeginFrame. So everything up to that frame is done.
+        std::vector<Resource>& resources = m_Resources[m_FrameCounter % m_FrameCount];
+        for (const auto& resource : resources)
+        {
+            LU_ASSERT(((resource.Frame + m_FrameCount) <= m_FrameCounter), "[VkDeletionQueue] Resource was destroyed before its frame finished.");
+            Destroy(resource);
+        }
+
+        resources.clear();
+    }
+
+    void VulkanDeletionQueue::DrainAll()
+    {
+        LU_PROFILE("VkDeletionQueue::DrainAll()");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        for (auto& resources : m_Resources)
+        {
+            for (const auto& resource : resources)
+                Destroy(resource);
+
+            resources.clear();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanDeletionQueue::Push(const Resource& resource)
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        Resource& entry = m_Resources[m_FrameCounter % m_FrameCount].emplace_back(resource);
+        entry.Frame = m_FrameCounter;
+    }
+
+    void VulkanDeletionQueue::Destroy(const Resource& resource)
+    {
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        switch (resource.ResourceType)
+        {
+        case Type::Buffer:
+            if (resource.Buffer != VK_NULL_HANDLE)
+                VulkanAllocator::DestroyBuffer(m_RendererID, resource.Buffer, resource.Allocation);
+            break;
+        case Type::Image:
+            if (resource.Image != VK_NULL_HANDLE && resource.Allocation != VK_NULL_HANDLE)
+                VulkanAllocator::DestroyImage(m_RendererID, resource.Image, resource.Allocation);
+            break;
+
+        case Type::ImageView:               vkDestroyImageView(device, resource.ImageView, nullptr);                        break;
+        case Type::Sampler:                 vkDestroySampler(device, resource.Sampler, nullptr);                            break;
+        case Type::Framebuffer:             vkDestroyFramebuffer(device, resource.Framebuffer, nullptr);                    break;
+        case Type::Renderpass:              vkDestroyRenderPass(device, resource.Renderpass, nullptr);                      break;
+        case Type::Pipeline:                vkDestroyPipeline(device, resource.Pipeline, nullptr);                          break;
+        case Type::PipelineLayout:          vkDestroyPipelineLayout(device, resource.PipelineLayout, nullptr);              break;
+        case Type::DescriptorPool:          vkDestroyDescriptorPool(device, resource.DescriptorPool, nullptr);              break;
+        case Type::DescriptorSetLayout:     vkDestroyDescriptorSetLayout(device, resource.DescriptorSetLayout, nullptr);    break;
+        case Type::ShaderModule:            vkDestroyShaderModule(device, resource.ShaderModule, nullptr);                  break;
+
+        case Type::Semaphore:
+            VulkanRenderer::GetRenderer(m_RendererID).GetTaskManager().RemoveFromAll(resource.Semaphore);
+            vkDestroySemaphore(device, resource.Semaphore, nullptr);
+            break;
+        case Type::Fence:
+            VulkanRenderer::GetRenderer(m_RendererID).GetTaskManager().RemoveFromAll(resource.Fence);
+            vkDestroyFence(device, resource.Fence, nullptr);
+            break;
+
+        default:
+            LU_ASSERT(false, "[VkDeletionQueue] Invalid resource type passed in.");
+            break;
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanDeletionQueue
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Resources are tagged with the number of the last frame that was begun (which is also the
+    // last frame that could have submitted work referencing them, even between Present & BeginFrame).
+    // They're only destroyed once as many frames as there are frames in flight have been begun since,
+    // at which point BeginFrame has waited on the fences of their frame.
+    // Note 2: Every frame number maps onto one of m_FrameCount vectors, which are cleared (not freed) when drained.
+    class VulkanDeletionQueue
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            None = 0,
+            Buffer, Image,
+            ImageView, Sampler,
+            Framebuffer, Renderpass,
+            Pipeline, PipelineLayout,
+            DescriptorPool, DescriptorSetLayout,
+            ShaderModule,
+            Semaphore, Fence
+        };
+
+        struct Resource
+        {
+        public:
+            Type ResourceType = Type::None;
+            union
+            {
+                VkBuffer Buffer;
+                VkImage Image;
+                VkImageView ImageView;
+                VkSampler Sampler;
+                VkFramebuffer Framebuffer;
+                VkRenderPass Renderpass;
+                VkPipeline Pipeline;
+                VkPipelineLayout PipelineLayout;
+                VkDescriptorPool DescriptorPool;
+                VkDescriptorSetLayout DescriptorSetLayout;
+                VkShaderModule ShaderModule;
+                VkSemaphore Semaphore;
+                VkFence Fence;
+            };
+            VmaAllocation Allocation = VK_NULL_HANDLE; // Only used for buffers & images
+
+            uint64_t Frame = 0; // Note: Set when pushed
+        };
+    public:
+        // Constructor & Destructor
+        VulkanDeletionQueue() = default;
+        ~VulkanDeletionQueue() = default;
+
+        // Init & Destroy
+        void Init(const RendererID rendererID, uint32_t frameCount);
+        void Destroy();
+
+        // Push methods
+        void Push(VkBuffer buffer, VmaAllocation allocation);
+        void Push(VkImage image, VmaAllocation allocation);
+        void Push(VkImageView imageView);
+        void Push(VkSampler sampler);
+        void Push(VkFramebuffer framebuffer);
+        void Push(VkRenderPass renderpass);
+        void Push(VkPipeline pipeline);
+        void Push(VkPipelineLayout pipelineLayout);
+        void Push(VkDescriptorPool descriptorPool);
+        void Push(VkDescriptorSetLayout descriptorSetLayout);
+        void Push(VkShaderModule shaderModule);
+        void Push(VkSemaphore semaphore);
+        void Push(VkFence fence);
+
+        // Methods
+        void BeginFrame(); // Note: Only call once the current frame's fences have been signaled
+        void DrainAll(); // Note: Only call when the device is idle
+
+    private:
+        // Private methods
+        void Push(const Resource& resource);
+        void Destroy(const Resource& resource);
+
+    private:
+        RendererID m_RendererID = 0;
+        uint32_t m_FrameCount = 0;
+        uint64_t m_FrameCounter = 0;
+
+        std::mutex m_ThreadSafety = {};
+        std::vector<std::vector<Resource>> m_Resources = { }; // Note: Indexed by frame number % m_FrameCount
+    };
+
+}
\ No newline at end of file
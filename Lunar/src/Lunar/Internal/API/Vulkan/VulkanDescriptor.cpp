@@ -10,6 +10,8 @@
 #include "Lunar/Internal/Renderer/Pipeline.hpp"
 #include "Lunar/Internal/Renderer/CommandBuffer.hpp"
 
+#include "Lunar/Internal/Memory/ScratchAllocator.hpp"
+
 #include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanImage.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanShader.hpp"
@@ -48,15 +50,16 @@ namespace Lunar::Internal
         vkCmdBindDescriptorSets(vkCmdBuf, PipelineBindPointToVkPipelineBindPoint(bindPoint), vkPipelineLayout, m_SetID, 1, &m_DescriptorSets[currentFrame], static_cast<uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
     }
 
-    void VulkanDescriptorSet::Upload(const RendererID renderer, const std::vector<Uploadable>& elements)
+    void VulkanDescriptorSet::Upload(const RendererID renderer, std::span<const Uploadable> elements)
     {
         LU_PROFILE("VkDescriptorSet::Upload()");
-        std::vector<VkWriteDescriptorSet> writes;
+        // Note: Reserved up front, since the writes point into the info vectors
+        std::pmr::vector<VkWriteDescriptorSet> writes(ScratchAllocator::Get());
         writes.reserve(elements.size());
 
-        std::vector<VkDescriptorImageInfo> imageInfos;
+        std::pmr::vector<VkDescriptorImageInfo> imageInfos(ScratchAllocator::Get());
         imageInfos.reserve(elements.size());
-        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        std::pmr::vector<VkDescriptorBufferInfo> bufferInfos(ScratchAllocator::Get());
         bufferInfos.reserve(elements.size());
 
         uint32_t currentFrame = VulkanRenderer::GetRenderer(renderer).GetVulkanSwapChain().GetCurrentFrame();
@@ -77,12 +80,13 @@ namespace Lunar::Internal
             LU_PROFILE("VkDescriptorSet::Upload::UpdateCmd");
             vkUpdateDescriptorSets(VulkanContext::GetVulkanDevice().GetVkDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
         }
+        VulkanRenderer::GetRenderer(renderer).AddFrameStat(FrameStat::DescriptorWrites, writes.size());
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanDescriptorSet::UploadImage(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorImageInfo>& imageInfos, VulkanImage& image, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame)
+    void VulkanDescriptorSet::UploadImage(std::pmr::vector<VkWriteDescriptorSet>& writes, std::pmr::vector<VkDescriptorImageInfo>& imageInfos, VulkanImage& image, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame)
     {
 		LU_PROFILE("VkDescriptorSet::UploadImage()");
         VkDescriptorImageInfo& imageInfo = imageInfos.emplace_back();
@@ -100,7 +104,7 @@ namespace Lunar::Internal
         descriptorWrite.pImageInfo = &imageInfo;
     }
 
-    void VulkanDescriptorSet::UploadUniformBuffer(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanUniformBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame)
+    void VulkanDescriptorSet::UploadUniformBuffer(std::pmr::vector<VkWriteDescriptorSet>& writes, std::pmr::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanUniformBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame)
     {
         LU_PROFILE("VkDescriptorSet::UploadUniformBuffer()");
         VkDescriptorBufferInfo& bufferInfo = bufferInfos.emplace_back();
@@ -118,7 +122,7 @@ namespace Lunar::Internal
         descriptorWrite.pBufferInfo = &bufferInfo;
     }
 
-    void VulkanDescriptorSet::UploadStorageBuffer(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanStorageBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame)
+    void VulkanDescriptorSet::UploadStorageBuffer(std::pmr::vector<VkWriteDescriptorSet>& writes, std::pmr::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanStorageBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame)
     {
         LU_PROFILE("VkDescriptorSet::UploadStorageBuffer()");
         VkDescriptorBufferInfo& bufferInfo = bufferInfos.emplace_back();
@@ -162,16 +166,11 @@ namespace Lunar::Internal
 
     void VulkanDescriptorSets::Destroy(const RendererID renderer)
     {
-        Renderer::GetRenderer(renderer).Free([descriptorPools = m_DescriptorPools, descriptorLayouts = m_DescriptorLayouts]()
-        {
-            auto device = VulkanContext::GetVulkanDevice().GetVkDevice();
-
-            for (auto& pool : descriptorPools)
-                vkDestroyDescriptorPool(device, pool, nullptr);
+        for (auto& pool : m_DescriptorPools)
+            VulkanRenderer::GetRenderer(renderer).Free(pool);
 
-            for (auto& layout : descriptorLayouts)
-                vkDestroyDescriptorSetLayout(device, layout, nullptr);
-        });
+        for (auto& layout : m_DescriptorLayouts)
+            VulkanRenderer::GetRenderer(renderer).Free(layout);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -6,7 +6,9 @@
 #include "Lunar/Internal/Renderer/PipelineSpec.hpp"
 
 #include <cstdint>
+#include <span>
 #include <vector>
+#include <memory_resource>
 
 namespace Lunar::Internal
 {
@@ -45,7 +47,7 @@ namespace Lunar::Internal
 		// Methods
 		void Bind(const RendererID renderer, Pipeline& pipeline, CommandBuffer& commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets);
 
-		void Upload(const RendererID renderer, const std::vector<Uploadable>& elements);
+		void Upload(const RendererID renderer, std::span<const Uploadable> elements);
 		
 		// Getters
 		inline uint8_t GetSetID() const { return m_SetID; }
@@ -55,9 +57,9 @@ namespace Lunar::Internal
 
 	private:
 		// Private methods
-		void UploadImage(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorImageInfo>& imageInfos, VulkanImage& image, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame);
-		void UploadUniformBuffer(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanUniformBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame);
-		void UploadStorageBuffer(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanStorageBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame);
+		void UploadImage(std::pmr::vector<VkWriteDescriptorSet>& writes, std::pmr::vector<VkDescriptorImageInfo>& imageInfos, VulkanImage& image, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame);
+		void UploadUniformBuffer(std::pmr::vector<VkWriteDescriptorSet>& writes, std::pmr::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanUniformBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame);
+		void UploadStorageBuffer(std::pmr::vector<VkWriteDescriptorSet>& writes, std::pmr::vector<VkDescriptorBufferInfo>& bufferInfos, VulkanStorageBuffer& buffer, Descriptor descriptor, uint32_t arrayIndex, uint32_t frame);
 
 	private:
 		uint8_t m_SetID = 0;
@@ -3,6 +3,9 @@
 
 #include "Lunar/Internal/IO/Print.hpp"
 
+#include <algorithm>
+#include <string_view>
+
 namespace Lunar::Internal
 {
 
@@ -33,6 +36,16 @@ namespace Lunar::Internal
 		dynamicRenderingFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
 		dynamicRenderingFeature.dynamicRendering = VK_TRUE;
 
+		// Enable synchronization2 features (for vkQueueSubmit2)
+		VkPhysicalDeviceSynchronization2Features synchronization2Feature = {};
+		synchronization2Feature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES;
+		synchronization2Feature.synchronization2 = VK_TRUE;
+
+		// Enable host query reset features (for the GPU profiler's timestamp queries)
+		VkPhysicalDeviceHostQueryResetFeatures hostQueryResetFeature = {};
+		hostQueryResetFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES;
+		hostQueryResetFeature.hostQueryReset = VK_TRUE;
+
 		// Enable descriptor indexing features (for bindless support)
 		VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexingFeatures = {};
 		indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
@@ -41,17 +54,41 @@ namespace Lunar::Internal
 		indexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
 		indexingFeatures.descriptorBindingVariableDescriptorCount = VK_TRUE;
 
-		// Chain both features into the pNext chain
+		// Enable texture compression where available, the block-compressed formats can't be used otherwise
+		VkPhysicalDeviceFeatures supportedFeatures = {};
+		vkGetPhysicalDeviceFeatures(m_PhysicalDevice->GetVkPhysicalDevice(), &supportedFeatures);
+
+		VkPhysicalDeviceFeatures enabledFeatures = g_VkRequestedDeviceFeatures;
+		enabledFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC;
+		enabledFeatures.textureCompressionETC2 = supportedFeatures.textureCompressionETC2;
+		enabledFeatures.textureCompressionASTC_LDR = supportedFeatures.textureCompressionASTC_LDR;
+
+		// Chain all features into the pNext chain
 		indexingFeatures.pNext = &dynamicRenderingFeature;
+		dynamicRenderingFeature.pNext = &synchronization2Feature;
+		synchronization2Feature.pNext = &hostQueryResetFeature;
+
+		// Note: Calibrated timestamps are optional, they're only used to line up GPU & CPU zones in the profiler
+		std::vector<const char*> extensions(g_VkRequestedDeviceExtensions.begin(), g_VkRequestedDeviceExtensions.end());
+		{
+			uint32_t extensionCount = 0;
+			vkEnumerateDeviceExtensionProperties(m_PhysicalDevice->GetVkPhysicalDevice(), nullptr, &extensionCount, nullptr);
+			std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+			vkEnumerateDeviceExtensionProperties(m_PhysicalDevice->GetVkPhysicalDevice(), nullptr, &extensionCount, availableExtensions.data());
+
+			m_CalibratedTimestamps = std::any_of(availableExtensions.begin(), availableExtensions.end(), [](const VkExtensionProperties& extension) { return std::string_view(extension.extensionName) == VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME; });
+			if (m_CalibratedTimestamps)
+				extensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+		}
 
 		VkDeviceCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-		createInfo.pNext = &indexingFeatures; // Chain indexing & dynamic rendering
+		createInfo.pNext = &indexingFeatures; // Chain indexing, dynamic rendering, synchronization2 & host query reset
 		createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
 		createInfo.pQueueCreateInfos = queueCreateInfos.data();
-		createInfo.pEnabledFeatures = &g_VkRequestedDeviceFeatures;
-		createInfo.enabledExtensionCount = static_cast<uint32_t>(g_VkRequestedDeviceExtensions.size());
-		createInfo.ppEnabledExtensionNames = g_VkRequestedDeviceExtensions.data();
+		createInfo.pEnabledFeatures = &enabledFeatures;
+		createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+		createInfo.ppEnabledExtensionNames = extensions.data();
 
 		if constexpr (g_VkValidation)
 		{
@@ -36,6 +36,8 @@ namespace Lunar::Internal
 
         inline VulkanPhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
 
+        inline bool SupportsCalibratedTimestamps() const { return m_CalibratedTimestamps; } // Note: VK_EXT_calibrated_timestamps
+
     private:
         VulkanPhysicalDevice* m_PhysicalDevice = nullptr;
         VkDevice m_LogicalDevice = VK_NULL_HANDLE;
@@ -43,6 +45,8 @@ namespace Lunar::Internal
         VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
         VkQueue m_ComputeQueue = VK_NULL_HANDLE;
         VkQueue m_PresentQueue = VK_NULL_HANDLE;
+
+        bool m_CalibratedTimestamps = false;
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "lupch.h"
+#include "VulkanFrameStats.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanFrameStats::Swap()
+    {
+        const uint32_t next = m_Current.load(std::memory_order_relaxed) ^ 1;
+
+        for (auto& counter : m_Counters[next])
+            counter.store(0, std::memory_order_relaxed);
+
+        // Note: Release, so a reader that sees the new index also sees the finished frame's counters
+        m_Current.store(next, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    FrameStats VulkanFrameStats::Get() const
+    {
+        const Counters& counters = m_Counters[m_Current.load(std::memory_order_acquire) ^ 1];
+        auto get = [&counters](FrameStat stat) { return counters[static_cast<size_t>(stat)].load(std::memory_order_relaxed); };
+
+        FrameStats stats = {};
+        stats.DrawCalls = get(FrameStat::DrawCalls);
+        stats.Indices = get(FrameStat::Indices);
+        stats.Quads = get(FrameStat::Quads);
+        stats.VertexBytes = get(FrameStat::VertexBytes);
+        stats.StagingAllocations = get(FrameStat::StagingAllocations);
+        stats.DescriptorWrites = get(FrameStat::DescriptorWrites);
+        stats.Submits = get(FrameStat::Submits);
+        stats.Barriers = get(FrameStat::Barriers);
+        stats.PipelineBinds = get(FrameStat::PipelineBinds);
+        return stats;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanFrameStats
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: The counters are double buffered, the hot paths (possibly on Record threads) increment
+    // the current set with relaxed atomics & BeginFrame swaps the sets. So the last finished frame
+    // can be read without locking, as long as it's read before the next BeginFrame.
+    class VulkanFrameStats
+    {
+    public:
+        // Constructor & Destructor
+        VulkanFrameStats() = default;
+        ~VulkanFrameStats() = default;
+
+        // Methods
+        inline void Add(FrameStat stat, uint64_t amount = 1) { m_Counters[m_Current.load(std::memory_order_relaxed)][static_cast<size_t>(stat)].fetch_add(amount, std::memory_order_relaxed); }
+
+        void Swap(); // Note: Only call from BeginFrame
+
+        // Getters
+        FrameStats Get() const; // Note: Of the last finished frame
+
+    private:
+        using Counters = std::array<std::atomic<uint64_t>, static_cast<size_t>(FrameStat::Count)>;
+
+        std::array<Counters, 2> m_Counters = { };
+        std::atomic<uint32_t> m_Current = 0;
+    };
+
+}
\ No newline at end of file
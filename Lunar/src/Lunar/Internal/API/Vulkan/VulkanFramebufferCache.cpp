@@ -0,0 +1,147 @@
+#include "lupch.h"
+#include "VulkanFramebufferCache.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanRenderer.hpp"
+
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanFramebufferCache::Init(const RendererID rendererID)
+    {
+        m_RendererID = rendererID;
+    }
+
+    void VulkanFramebufferCache::Destroy()
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        for (const auto& [key, entry] : m_Framebuffers)
+            vkDestroyFramebuffer(device, entry.Framebuffer, nullptr);
+
+        m_Framebuffers.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VkFramebuffer VulkanFramebufferCache::Get(VkRenderPass renderpass, std::span<const VkImageView> attachments, uint32_t width, uint32_t height)
+    {
+        LU_PROFILE("VkFramebufferCache::Get()");
+        LU_ASSERT((attachments.size() <= MaxAttachments), std::format("[VkFramebufferCache] Framebuffers can have at most {0} attachments.", MaxAttachments));
+
+        Key key = {};
+        key.Renderpass = renderpass;
+        key.AttachmentCount = static_cast<uint32_t>(attachments.size());
+        key.Width = width;
+        key.Height = height;
+        std::copy(attachments.begin(), attachments.end(), key.Attachments.begin());
+
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        auto it = m_Framebuffers.find(key);
+        if (it != m_Framebuffers.end())
+        {
+            it->second.LastUsed = m_Frame;
+            return it->second.Framebuffer;
+        }
+
+        VkFramebufferCreateInfo framebufferInfo = {};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = renderpass;
+        framebufferInfo.attachmentCount = key.AttachmentCount;
+        framebufferInfo.pAttachments = key.Attachments.data();
+        framebufferInfo.width = width;
+        framebufferInfo.height = height;
+        framebufferInfo.layers = 1;
+
+        Entry& entry = m_Framebuffers[key];
+        entry.LastUsed = m_Frame;
+
+        VK_VERIFY(vkCreateFramebuffer(VulkanContext::GetVulkanDevice().GetVkDevice(), &framebufferInfo, nullptr, &entry.Framebuffer));
+        return entry.Framebuffer;
+    }
+
+    void VulkanFramebufferCache::Evict(VkRenderPass renderpass)
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        std::erase_if(m_Framebuffers, [this, renderpass](const auto& pair)
+        {
+            if (pair.first.Renderpass != renderpass)
+                return false;
+
+            VulkanRenderer::GetRenderer(m_RendererID).GetDeletionQueue().Push(pair.second.Framebuffer);
+            return true;
+        });
+    }
+
+    void VulkanFramebufferCache::Evict(VkImageView imageView)
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        // Note: Has to happen before the view is destroyed, since the driver may hand out the same handle again
+        std::erase_if(m_Framebuffers, [this, imageView](const auto& pair)
+        {
+            const auto begin = pair.first.Attachments.begin();
+            const auto end = begin + pair.first.AttachmentCount;
+            if (std::find(begin, end, imageView) == end)
+                return false;
+
+            VulkanRenderer::GetRenderer(m_RendererID).GetDeletionQueue().Push(pair.second.Framebuffer);
+            return true;
+        });
+    }
+
+    void VulkanFramebufferCache::Update()
+    {
+        LU_PROFILE("VkFramebufferCache::Update()");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        m_Frame++;
+        if (m_Frame <= MaxUnusedFrames)
+            return;
+
+        std::erase_if(m_Framebuffers, [this](const auto& pair)
+        {
+            if (pair.second.LastUsed >= (m_Frame - MaxUnusedFrames))
+                return false;
+
+            VulkanRenderer::GetRenderer(m_RendererID).GetDeletionQueue().Push(pair.second.Framebuffer);
+            return true;
+        });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t VulkanFramebufferCache::KeyHash::operator () (const Key& key) const
+    {
+        // Note: FNV-1a over the handles, Vulkan handles are either pointers or 64 bit integers
+        constexpr uint64_t fnvPrime = 1099511628211u;
+        uint64_t hash = 14695981039346656037u;
+
+        auto feed = [&hash](uint64_t value)
+        {
+            hash ^= value;
+            hash *= fnvPrime;
+        };
+
+        feed(reinterpret_cast<uint64_t>(key.Renderpass));
+        for (uint32_t i = 0; i < key.AttachmentCount; i++)
+            feed(reinterpret_cast<uint64_t>(key.Attachments[i]));
+        feed((static_cast<uint64_t>(key.Width) << 32) | key.Height);
+
+        return static_cast<size_t>(hash);
+    }
+
+}
\ No newline at end of file
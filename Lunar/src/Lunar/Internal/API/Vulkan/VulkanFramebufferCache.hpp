@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanFramebufferCache
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Framebuffers are created on first use and keyed by the renderpass, attachment views & extent.
+    // A recreated attachment has a new view and thus simply misses the cache, the old entries are
+    // evicted (through the deletion queue) once their view or renderpass is freed or they go unused.
+    class VulkanFramebufferCache
+    {
+    public:
+        constexpr static const uint32_t MaxAttachments = 8;
+        constexpr static const uint64_t MaxUnusedFrames = 16; // Note: Entries unused for this many frames get evicted
+    public:
+        // Constructor & Destructor
+        VulkanFramebufferCache() = default;
+        ~VulkanFramebufferCache() = default;
+
+        // Init & Destroy
+        void Init(const RendererID rendererID);
+        void Destroy(); // Note: Only call when the device is idle
+
+        // Methods
+        VkFramebuffer Get(VkRenderPass renderpass, std::span<const VkImageView> attachments, uint32_t width, uint32_t height);
+
+        void Evict(VkRenderPass renderpass);
+        void Evict(VkImageView imageView);
+
+        void Update(); // Note: Called every BeginFrame, evicts entries that went unused
+
+    private:
+        struct Key
+        {
+        public:
+            VkRenderPass Renderpass = VK_NULL_HANDLE;
+            std::array<VkImageView, MaxAttachments> Attachments = { };
+            uint32_t AttachmentCount = 0;
+            uint32_t Width = 0, Height = 0;
+
+        public:
+            bool operator == (const Key& other) const = default;
+        };
+
+        struct KeyHash
+        {
+        public:
+            size_t operator () (const Key& key) const;
+        };
+
+        struct Entry
+        {
+        public:
+            VkFramebuffer Framebuffer = VK_NULL_HANDLE;
+            uint64_t LastUsed = 0;
+        };
+
+    private:
+        RendererID m_RendererID = 0;
+        uint64_t m_Frame = 0;
+
+        std::mutex m_ThreadSafety = {}; // Note: Secondary command buffers may request framebuffers from worker threads
+        std::unordered_map<Key, Entry, KeyHash> m_Framebuffers = { };
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include "lupch.h"
+#include "VulkanGPUProfiler.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanCommandBuffer.hpp"
+
+#include <limits>
+#include <cstring>
+#include <algorithm>
+
+#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING && defined(TRACY_ENABLE)
+    #define LU_GPU_PROFILING_TRACY
+
+    #include <tracy/TracyVulkan.hpp>
+#endif
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanGPUProfiler::Init(const RendererID rendererID, uint32_t queueFamily, uint32_t frameCount)
+    {
+        m_RendererID = rendererID;
+
+        const VkPhysicalDevice physicalDevice = VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice();
+        const VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        VkPhysicalDeviceProperties properties = {};
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> families(familyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+
+        const uint32_t validBits = families[queueFamily].timestampValidBits;
+        m_Supported = (validBits > 0) && (properties.limits.timestampPeriod > 0.0f);
+        if (!m_Supported)
+        {
+            LU_LOG_CAT(Warn, Vulkan, "[VkGPUProfiler] The graphics queue doesn't support timestamps, GPU zones are disabled.");
+            return;
+        }
+
+        m_Period = static_cast<double>(properties.limits.timestampPeriod);
+        m_ValidMask = ((validBits >= 64) ? std::numeric_limits<uint64_t>::max() : ((uint64_t(1) << validBits) - 1));
+
+        VkQueryPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        poolInfo.queryCount = MaxZones * 2;
+
+        m_Frames.resize(static_cast<size_t>(frameCount));
+        for (auto& frame : m_Frames)
+        {
+            VK_VERIFY(vkCreateQueryPool(device, &poolInfo, nullptr, &frame.Pool));
+            vkResetQueryPool(device, frame.Pool, 0, poolInfo.queryCount);
+
+            frame.Zones.reserve(MaxZones);
+        }
+
+        m_Results.reserve(static_cast<size_t>(MaxZones) * 4);
+        m_Timings.reserve(MaxZones);
+
+        #if defined(LU_GPU_PROFILING_TRACY)
+        {
+            VkCommandPoolCreateInfo commandPoolInfo = {};
+            commandPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            commandPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            commandPoolInfo.queueFamilyIndex = queueFamily;
+            VK_VERIFY(vkCreateCommandPool(device, &commandPoolInfo, nullptr, &m_TracyCommandPool));
+
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = m_TracyCommandPool;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount = 1;
+            VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, &m_TracyCommandBuffer));
+
+            VkFenceCreateInfo fenceInfo = {};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+            VK_VERIFY(vkCreateFence(device, &fenceInfo, nullptr, &m_TracyFence));
+
+            // Note: Calibration lines the GPU zones up with the CPU zones, without it Tracy estimates the offset once
+            const VkQueue queue = VulkanContext::GetVulkanDevice().GetGraphicsQueue();
+            if (VulkanContext::GetVulkanDevice().SupportsCalibratedTimestamps())
+            {
+                auto getTimeDomains = reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(vkGetInstanceProcAddr(VulkanContext::GetVkInstance(), "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT"));
+                auto getTimestamps = reinterpret_cast<PFN_vkGetCalibratedTimestampsEXT>(vkGetDeviceProcAddr(device, "vkGetCalibratedTimestampsEXT"));
+
+                m_TracyContext = TracyVkContextCalibrated(physicalDevice, device, queue, m_TracyCommandBuffer, getTimeDomains, getTimestamps);
+            }
+            else
+            {
+                m_TracyContext = TracyVkContext(physicalDevice, device, queue, m_TracyCommandBuffer);
+            }
+        }
+        #endif
+    }
+
+    void VulkanGPUProfiler::Destroy()
+    {
+        if (!m_Supported)
+            return;
+
+        const VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        #if defined(LU_GPU_PROFILING_TRACY)
+        vkWaitForFences(device, 1, &m_TracyFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        TracyVkDestroy(static_cast<TracyVkCtx>(m_TracyContext));
+
+        vkDestroyFence(device, m_TracyFence, nullptr);
+        vkDestroyCommandPool(device, m_TracyCommandPool, nullptr);
+        m_TracyContext = nullptr;
+        #endif
+
+        for (auto& frame : m_Frames)
+            vkDestroyQueryPool(device, frame.Pool, nullptr);
+
+        m_Frames.clear();
+        m_Timings.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanGPUProfiler::BeginFrame(uint32_t frame)
+    {
+        if (!m_Supported)
+            return;
+
+        LU_PROFILE("VkGPUProfiler::BeginFrame()");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        m_CurrentFrame = frame;
+        Frame& current = m_Frames[m_CurrentFrame];
+
+        ReadBack(current);
+
+        vkResetQueryPool(VulkanContext::GetVulkanDevice().GetVkDevice(), current.Pool, 0, MaxZones * 2);
+        current.Zones.clear();
+    }
+
+    void VulkanGPUProfiler::EndFrame()
+    {
+        #if defined(LU_GPU_PROFILING_TRACY)
+        if (!m_TracyContext)
+            return;
+
+        LU_PROFILE("VkGPUProfiler::EndFrame::TracyCollect");
+        const VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        // Note: The previous collection has had a whole frame to finish, so this rarely waits
+        vkWaitForFences(device, 1, &m_TracyFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        vkResetFences(device, 1, &m_TracyFence);
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        VK_VERIFY(vkBeginCommandBuffer(m_TracyCommandBuffer, &beginInfo));
+        TracyVkCollect(static_cast<TracyVkCtx>(m_TracyContext), m_TracyCommandBuffer);
+        VK_VERIFY(vkEndCommandBuffer(m_TracyCommandBuffer));
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &m_TracyCommandBuffer;
+        VK_VERIFY(vkQueueSubmit(VulkanContext::GetVulkanDevice().GetGraphicsQueue(), 1, &submitInfo, m_TracyFence));
+        #endif
+    }
+
+    uint32_t VulkanGPUProfiler::BeginZone(VulkanCommandBuffer& cmdBuf, const char* name)
+    {
+        if (!m_Supported)
+            return InvalidZone;
+
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        Frame& frame = m_Frames[m_CurrentFrame];
+
+        if (frame.Zones.size() >= MaxZones) [[unlikely]]
+            return InvalidZone;
+
+        const uint32_t zone = static_cast<uint32_t>(frame.Zones.size());
+        const VkCommandBuffer commandBuffer = cmdBuf.GetVkCommandBuffer(m_CurrentFrame);
+
+        Zone& entry = frame.Zones.emplace_back();
+        entry.Name = name;
+
+        vkCmdWriteTimestamp2(commandBuffer, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, frame.Pool, zone * 2);
+
+        #if defined(LU_GPU_PROFILING_TRACY)
+        if (m_TracyContext)
+        {
+            const size_t nameSize = std::strlen(name);
+            entry.TracyScope = new tracy::VkCtxScope(static_cast<TracyVkCtx>(m_TracyContext), __LINE__, __FILE__, std::strlen(__FILE__), name, nameSize, name, nameSize, commandBuffer, true);
+        }
+        #endif
+
+        return zone;
+    }
+
+    void VulkanGPUProfiler::EndZone(VulkanCommandBuffer& cmdBuf, uint32_t zone)
+    {
+        if (zone == InvalidZone)
+            return;
+
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        Frame& frame = m_Frames[m_CurrentFrame];
+
+        vkCmdWriteTimestamp2(cmdBuf.GetVkCommandBuffer(m_CurrentFrame), VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT, frame.Pool, zone * 2 + 1);
+
+        #if defined(LU_GPU_PROFILING_TRACY)
+        // Note: Destroying the scope records Tracy's end timestamp
+        delete static_cast<tracy::VkCtxScope*>(frame.Zones[zone].TracyScope);
+        frame.Zones[zone].TracyScope = nullptr;
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanGPUProfiler::ReadBack(Frame& frame)
+    {
+        m_Timings.clear();
+        if (frame.Zones.empty())
+            return;
+
+        // Note: Zones that weren't ended or whose command buffer wasn't submitted stay unavailable, so we don't wait
+        const uint32_t queryCount = static_cast<uint32_t>(frame.Zones.size()) * 2;
+        m_Results.resize(static_cast<size_t>(queryCount) * 2);
+
+        VkResult result = vkGetQueryPoolResults(VulkanContext::GetVulkanDevice().GetVkDevice(), frame.Pool, 0, queryCount, m_Results.size() * sizeof(uint64_t), m_Results.data(), sizeof(uint64_t) * 2, VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (result != VK_SUCCESS && result != VK_NOT_READY)
+            return;
+
+        uint64_t first = std::numeric_limits<uint64_t>::max();
+        for (size_t i = 0; i < frame.Zones.size(); i++)
+        {
+            const uint64_t* begin = &m_Results[i * 4];
+            const uint64_t* end = &m_Results[i * 4 + 2];
+            if (!begin[1] || !end[1])
+                continue;
+
+            first = std::min(first, begin[0] & m_ValidMask);
+
+            GPUZoneTiming& timing = m_Timings.emplace_back();
+            timing.Name = frame.Zones[i].Name;
+            timing.Start = static_cast<double>(begin[0] & m_ValidMask); // Note: In ticks until all zones are known
+            timing.Duration = static_cast<double>((end[0] - begin[0]) & m_ValidMask) * m_Period / 1'000'000.0;
+        }
+
+        for (auto& timing : m_Timings)
+            timing.Start = (timing.Start - static_cast<double>(first)) * m_Period / 1'000'000.0;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    class VulkanCommandBuffer;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanGPUProfiler
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Every frame in flight has its own timestamp query pool, a zone writes one timestamp
+    // when it begins & one when it ends. The results of a frame are read back (without waiting)
+    // once its fences have been waited on, so they lag behind by the amount of frames in flight.
+    // Note 2: In profiling builds the zones are also sent to Tracy's GPU context, with calibrated
+    // timestamps when VK_EXT_calibrated_timestamps is available.
+    class VulkanGPUProfiler
+    {
+    public:
+        constexpr static const uint32_t MaxZones = 256; // Note: Per frame, zones after this aren't measured
+        constexpr static const uint32_t InvalidZone = 0xFFFFFFFF;
+    public:
+        // Constructor & Destructor
+        VulkanGPUProfiler() = default;
+        ~VulkanGPUProfiler() = default;
+
+        // Init & Destroy
+        void Init(const RendererID rendererID, uint32_t queueFamily, uint32_t frameCount);
+        void Destroy();
+
+        // Methods
+        void BeginFrame(uint32_t frame); // Note: Only call once the frame's fences have been signaled
+        void EndFrame();
+
+        uint32_t BeginZone(VulkanCommandBuffer& cmdBuf, const char* name); // Note: The name has to outlive the results
+        void EndZone(VulkanCommandBuffer& cmdBuf, uint32_t zone);
+
+        // Getters
+        inline bool IsSupported() const { return m_Supported; }
+        inline const std::vector<GPUZoneTiming>& GetTimings() const { return m_Timings; } // Note: Of the last frame that finished
+
+    private:
+        struct Zone
+        {
+        public:
+            const char* Name = nullptr;
+            void* TracyScope = nullptr;
+        };
+
+        struct Frame
+        {
+        public:
+            VkQueryPool Pool = VK_NULL_HANDLE;
+            std::vector<Zone> Zones = { };
+        };
+
+    private:
+        // Private methods
+        void ReadBack(Frame& frame);
+
+    private:
+        RendererID m_RendererID = 0;
+        bool m_Supported = false;
+
+        double m_Period = 1.0; // Note: Nanoseconds per tick
+        uint64_t m_ValidMask = 0;
+
+        std::mutex m_ThreadSafety = {};
+        std::vector<Frame> m_Frames = { };
+        uint32_t m_CurrentFrame = 0;
+
+        std::vector<uint64_t> m_Results = { }; // Note: Pairs of timestamp & availability
+        std::vector<GPUZoneTiming> m_Timings = { };
+
+        // Note: Only used with Tracy
+        void* m_TracyContext = nullptr;
+        VkCommandPool m_TracyCommandPool = VK_NULL_HANDLE;
+        VkCommandBuffer m_TracyCommandBuffer = VK_NULL_HANDLE;
+        VkFence m_TracyFence = VK_NULL_HANDLE;
+    };
+
+}
\ No newline at end of file
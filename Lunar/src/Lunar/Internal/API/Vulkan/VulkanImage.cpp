@@ -3,13 +3,21 @@
 
 #include "Lunar/Internal/IO/Print.hpp"
 #include "Lunar/Internal/Utils/Settings.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
 
 #include "Lunar/Internal/Enum/Fuse.hpp"
 
+#include "Lunar/Internal/Renderer/MipChain.hpp"
+
 #include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanRenderer.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanAllocator.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanImageStreamer.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanImageContainer.hpp"
+
+#include "Lunar/Internal/IO/MappedFile.hpp"
 
+#include <cstring>
 #include <filesystem>
 
 //#define STBI_ASSERT(x) LU_ASSERT(x, std::format("[VkImage:stb_image] '{0}'", #x))
@@ -42,6 +50,67 @@ namespace Lunar::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	static VkImageAspectFlags GetVulkanImageAspectFromImageUsage(VkImageUsageFlags usage);
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Copying & Moving
+	////////////////////////////////////////////////////////////////////////////////////
+	VulkanImage::VulkanImage(const VulkanImage& other)
+	{
+		*this = other;
+	}
+
+	VulkanImage& VulkanImage::operator = (const VulkanImage& other)
+	{
+		if (this == &other)
+			return *this;
+
+		m_ImageSpecification = other.m_ImageSpecification;
+		m_SamplerSpecification = other.m_SamplerSpecification;
+
+		m_Image = other.m_Image;
+		m_Allocation = other.m_Allocation;
+		m_ImageView = other.m_ImageView;
+		m_Sampler = other.m_Sampler;
+
+		m_Miplevels = other.m_Miplevels;
+
+		// Note: Only the original is the streamer's target, a shared request would keep IsLoaded() false forever
+		m_StreamRequest = nullptr;
+		m_LoadFailed = other.m_LoadFailed;
+		m_Aliased = other.m_Aliased;
+
+		return *this;
+	}
+
+	VulkanImage::VulkanImage(VulkanImage&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	VulkanImage& VulkanImage::operator = (VulkanImage&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		m_ImageSpecification = other.m_ImageSpecification;
+		m_SamplerSpecification = other.m_SamplerSpecification;
+
+		m_Image = other.m_Image;
+		m_Allocation = other.m_Allocation;
+		m_ImageView = other.m_ImageView;
+		m_Sampler = other.m_Sampler;
+
+		m_Miplevels = other.m_Miplevels;
+
+		// Note: The streamer uploads into the request's target, so it has to point at the new location
+		m_StreamRequest = std::move(other.m_StreamRequest);
+		if (m_StreamRequest)
+			m_StreamRequest->Target = this;
+		m_LoadFailed = other.m_LoadFailed;
+		m_Aliased = other.m_Aliased;
+
+		return *this;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Init & Destroy
 	////////////////////////////////////////////////////////////////////////////////////
@@ -73,8 +142,41 @@ namespace Lunar::Internal
 		m_ImageView = imageView;
 	}
 
+	void VulkanImage::InitAsync(const RendererID renderer, const ImageSpecification& imageSpecs, const SamplerSpecification& samplerSpecs, const std::filesystem::path& imagePath)
+	{
+		m_ImageSpecification = imageSpecs;
+		m_SamplerSpecification = samplerSpecs;
+
+		LU_ASSERT(((m_ImageSpecification.Usage & ImageUsage::Colour) || (m_ImageSpecification.Usage & ImageUsage::DepthStencil)), "[VulkanImage] Tried to create image without specifying if it's a Colour or Depth image.");
+
+		// Note: Containers hold pre-decoded data, so there is nothing to offload
+		if (VulkanImageContainer::IsContainer(imagePath))
+		{
+			CreateImageFromContainer(renderer, imagePath);
+			return;
+		}
+
+		m_LoadFailed = false;
+		m_StreamRequest = VulkanRenderer::GetRenderer(renderer).GetImageStreamer().Load(*this, imagePath);
+	}
+
 	void VulkanImage::Destroy(const RendererID renderer)
 	{
+		// Note: A pending load has no GPU resources yet, the streamer drops it once the worker is done
+		if (m_StreamRequest)
+		{
+			m_StreamRequest->Cancelled = true;
+			m_StreamRequest.reset();
+			return;
+		}
+
+		// Note: A failed load never created any GPU resources
+		if (m_LoadFailed)
+		{
+			m_LoadFailed = false;
+			return;
+		}
+
 		DestroyImage(renderer);
 	}
 
@@ -84,6 +186,31 @@ namespace Lunar::Internal
 	void VulkanImage::SetData(const RendererID renderer, void* data, size_t size)
 	{
 		ImageLayout desiredLayout = m_ImageSpecification.Layout;
+		LU_ASSERT((size >= GetVkFormatLevelSize(ImageFormatToVkFormat(m_ImageSpecification.Format), m_ImageSpecification.Width, m_ImageSpecification.Height)), "[VulkanImage] Data passed to SetData is smaller than the image.");
+
+		// Build the whole chain straight into the staging buffer & upload it in one copy
+		// Note: Also used when the format can't be blitted with linear filtering
+		const bool linearBlit = VulkanContext::GetVulkanPhysicalDevice().IsFormatSupported(ImageFormatToVkFormat(m_ImageSpecification.Format), VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT);
+		if (m_Miplevels > 1 && (m_ImageSpecification.MipMapGeneration == MipmapGeneration::CPU || !linearBlit))
+		{
+			LU_ASSERT((GetVkFormatBlock(ImageFormatToVkFormat(m_ImageSpecification.Format)).Size == 4), "[VulkanImage] CPU mipmap generation only supports 4 byte per texel formats.");
+
+			VkBuffer stagingBuffer = VK_NULL_HANDLE;
+			VmaAllocation stagingBufferAllocation = VulkanAllocator::AllocateBuffer(renderer, MipChain::GetSize(m_ImageSpecification.Width, m_ImageSpecification.Height), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY, stagingBuffer);
+
+			void* mappedData = nullptr;
+			VulkanAllocator::MapMemory(stagingBufferAllocation, mappedData);
+			MipChain::Generate(static_cast<const uint8_t*>(data), m_ImageSpecification.Width, m_ImageSpecification.Height, static_cast<uint8_t*>(mappedData));
+			VulkanAllocator::UnMapMemory(stagingBufferAllocation);
+
+			VulkanCommand command(renderer, true);
+			RecordUpload(command.GetVkCommandBuffer(), stagingBuffer, GetLevelRegions(0, m_Miplevels));
+			command.EndAndSubmit();
+
+			Transition(renderer, ImageLayout::ShaderRead, desiredLayout);
+			VulkanAllocator::DestroyBuffer(renderer, stagingBuffer, stagingBufferAllocation);
+			return;
+		}
 
 		VkBuffer stagingBuffer = VK_NULL_HANDLE;
 		VmaAllocation stagingBufferAllocation = VulkanAllocator::AllocateBuffer(renderer, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY, stagingBuffer);
@@ -93,7 +220,7 @@ namespace Lunar::Internal
 		Transition(renderer, ImageLayout::Undefined, ImageLayout::TransferDst);
 		VulkanAllocator::CopyBufferToImage(renderer, stagingBuffer, m_Image, m_ImageSpecification.Width, m_ImageSpecification.Height);
 
-		if (m_ImageSpecification.MipMaps)
+		if (m_ImageSpecification.MipMaps && m_Miplevels > 1)
 		{
 			GenerateMipmaps(renderer, m_Image, ImageFormatToVkFormat(m_ImageSpecification.Format), m_ImageSpecification.Width, m_ImageSpecification.Height, m_Miplevels);
 			Transition(renderer, ImageLayout::ShaderRead, desiredLayout);
@@ -106,8 +233,82 @@ namespace Lunar::Internal
 		VulkanAllocator::DestroyBuffer(renderer, stagingBuffer, stagingBufferAllocation);
 	}
 
+	void VulkanImage::GetData(const RendererID renderer, std::vector<uint8_t>& data, ImageLayout current)
+	{
+		LU_PROFILE("VkImage::GetData()");
+		LU_ASSERT((m_ImageSpecification.Usage & ImageUsage::TransferSrc), "[VulkanImage] Reading back an image requires ImageUsage::TransferSrc.");
+		LU_ASSERT((current != ImageLayout::Undefined), "[VulkanImage] Can't read back an image with undefined contents.");
+
+		const VkFormat format = ImageFormatToVkFormat(m_ImageSpecification.Format);
+		const size_t size = GetVkFormatLevelSize(format, m_ImageSpecification.Width, m_ImageSpecification.Height);
+
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+		VmaAllocation stagingBufferAllocation = VulkanAllocator::AllocateBuffer(renderer, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU, stagingBuffer);
+
+		VulkanCommand command(renderer, true);
+
+		// Note: The barrier's first scope includes everything submitted before on the graphics queue, so the frame is finished rendering
+		VkImageMemoryBarrier2 barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+		barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+		barrier.srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT;
+		barrier.dstStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+		barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+		barrier.oldLayout = ImageLayoutToVkImageLayout(current);
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = m_Image;
+		barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+		VkDependencyInfo dependencyInfo = {};
+		dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+		dependencyInfo.imageMemoryBarrierCount = 1;
+		dependencyInfo.pImageMemoryBarriers = &barrier;
+		vkCmdPipelineBarrier2(command.GetVkCommandBuffer(), &dependencyInfo);
+
+		VkBufferImageCopy region = {};
+		region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+		region.imageExtent = { m_ImageSpecification.Width, m_ImageSpecification.Height, 1 };
+		vkCmdCopyImageToBuffer(command.GetVkCommandBuffer(), m_Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, stagingBuffer, 1, &region);
+
+		// Move the image back & make the copy visible to the host
+		std::swap(barrier.oldLayout, barrier.newLayout);
+		barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+		barrier.srcAccessMask = VK_ACCESS_2_NONE;
+		barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+		barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+		VkMemoryBarrier2 hostBarrier = {};
+		hostBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+		hostBarrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+		hostBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+		hostBarrier.dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT;
+		hostBarrier.dstAccessMask = VK_ACCESS_2_HOST_READ_BIT;
+
+		dependencyInfo.memoryBarrierCount = 1;
+		dependencyInfo.pMemoryBarriers = &hostBarrier;
+		vkCmdPipelineBarrier2(command.GetVkCommandBuffer(), &dependencyInfo);
+
+		command.EndAndSubmit();
+
+		data.resize(size);
+
+		void* mappedData = nullptr;
+		VulkanAllocator::MapMemory(stagingBufferAllocation, mappedData);
+		vmaInvalidateAllocation(VulkanAllocator::s_Allocator, stagingBufferAllocation, 0, VK_WHOLE_SIZE);
+		std::memcpy(data.data(), mappedData, size);
+		VulkanAllocator::UnMapMemory(stagingBufferAllocation);
+
+		VulkanAllocator::DestroyBuffer(renderer, stagingBuffer, stagingBufferAllocation);
+	}
+
 	void VulkanImage::Resize(const RendererID renderer, uint32_t width, uint32_t height)
 	{
+		// Note: Resize events often repeat the current size, recreating would only churn objects
+		if (m_Image != VK_NULL_HANDLE && width == m_ImageSpecification.Width && height == m_ImageSpecification.Height)
+			return;
+
 		Destroy(renderer);
 		CreateImage(renderer, width, height);
 	}
@@ -118,6 +319,17 @@ namespace Lunar::Internal
 			return;
 
 		VulkanCommand command(renderer, true);
+		RecordTransition(renderer, command.GetVkCommandBuffer(), initial, final);
+		command.EndAndSubmit();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanImage::RecordTransition(const RendererID renderer, VkCommandBuffer commandBuffer, ImageLayout initial, ImageLayout final)
+	{
+		if (initial == final)
+			return;
 
 		VkImageMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -335,27 +547,44 @@ namespace Lunar::Internal
 			break;
 		}
 
-		vkCmdPipelineBarrier(command.GetVkCommandBuffer(), sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-		command.EndAndSubmit();
+		vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+		VulkanRenderer::GetRenderer(renderer).AddFrameStat(FrameStat::Barriers);
 
 		// Set the layout
 		m_ImageSpecification.Layout = final;
 	}
 
-	////////////////////////////////////////////////////////////////////////////////////
-	// Private methods
-	////////////////////////////////////////////////////////////////////////////////////
 	void VulkanImage::CreateImage(const RendererID renderer, uint32_t width, uint32_t height)
 	{
 		ImageLayout desiredLayout = m_ImageSpecification.Layout;
 
 		m_ImageSpecification.Width = width;
 		m_ImageSpecification.Height = height;
-		if (m_ImageSpecification.MipMaps)
+
+		// Note: Compressed images can't be blitted to or rendered into, so their mips have to come with the data
+		const bool compressed = IsCompressedVkFormat(ImageFormatToVkFormat(m_ImageSpecification.Format));
+		// Note: Transient images only live inside a renderpass, their contents are never loaded, stored or sampled
+		const bool transient = static_cast<bool>(m_ImageSpecification.Usage & ImageUsage::Transient);
+		if (m_ImageSpecification.MipMaps && !compressed && !transient)
 			m_Miplevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
 
-		m_Allocation = VulkanAllocator::AllocateImage(renderer, width, height, m_Miplevels, ImageFormatToVkFormat(m_ImageSpecification.Format), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(m_ImageSpecification.Usage), VMA_MEMORY_USAGE_GPU_ONLY, m_Image);
+		VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(m_ImageSpecification.Usage);
+		VmaMemoryUsage memoryUsage = VMA_MEMORY_USAGE_GPU_ONLY;
+		if (compressed)
+			usage &= ~(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+		if (transient)
+		{
+			#if !defined(LU_CONFIG_DIST)
+			if (usage & ~(VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT))
+				LU_LOG_CAT(Warn, Vulkan, "[VulkanImage] Transient images can only be used as attachments, other usages are ignored.");
+			#endif
+
+			usage &= (VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT);
+			if (VulkanContext::GetVulkanPhysicalDevice().HasLazilyAllocatedMemory())
+				memoryUsage = VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED;
+		}
+
+		m_Allocation = VulkanAllocator::AllocateImage(renderer, width, height, m_Miplevels, ImageFormatToVkFormat(m_ImageSpecification.Format), VK_IMAGE_TILING_OPTIMAL, usage, memoryUsage, m_Image);
 
 		m_ImageView = VulkanAllocator::CreateImageView(renderer, m_Image, ImageFormatToVkFormat(m_ImageSpecification.Format), GetVulkanImageAspectFromImageUsage(ImageUsageToVkImageUsage(m_ImageSpecification.Usage)), m_Miplevels);
 		m_Sampler = VulkanAllocator::CreateSampler(renderer, FilterModeToVkFilter(m_SamplerSpecification.MagFilter), FilterModeToVkFilter(m_SamplerSpecification.MinFilter), AddressModeToVkSamplerAddressMode(m_SamplerSpecification.Address), MipmapModeToVkSamplerMipmapMode(m_SamplerSpecification.Mipmaps), m_Miplevels);
@@ -365,12 +594,23 @@ namespace Lunar::Internal
 
 	void VulkanImage::CreateImage(const RendererID renderer, const std::filesystem::path& imagePath)
 	{
+		if (VulkanImageContainer::IsContainer(imagePath))
+		{
+			CreateImageFromContainer(renderer, imagePath);
+			return;
+		}
+
 		int width, height, texChannels;
 
 		stbi_set_flip_vertically_on_load(1);
 		stbi_uc* pixels = stbi_load(imagePath.string().c_str(), &width, &height, &texChannels, STBI_rgb_alpha); // STBI_default, STBI_rgb_alpha
 
-		LU_ASSERT((pixels != nullptr), std::format("[VkImage] Failed to load image from '{0}'", imagePath.string()));
+		if (pixels == nullptr) [[unlikely]]
+		{
+			LU_LOG_CAT(Error, IO, "[VkImage] Failed to load image from '{0}', using a placeholder instead.", imagePath.string());
+			CreatePlaceholder(renderer);
+			return;
+		}
 
 		m_ImageSpecification.Width = static_cast<uint32_t>(width);
 		m_ImageSpecification.Height = static_cast<uint32_t>(height);
@@ -389,6 +629,109 @@ namespace Lunar::Internal
 		stbi_image_free((void*)pixels);
 	}
 
+	void VulkanImage::CreatePlaceholder(const RendererID renderer)
+	{
+		// Note: A single white texel, so anything sampling it still renders (tinted by its colour)
+		m_ImageSpecification.Format = ImageFormat::RGBA;
+		m_ImageSpecification.MipMaps = false;
+		m_Miplevels = 1;
+
+		CreateImage(renderer, 1, 1);
+
+		uint32_t white = 0xFFFFFFFF;
+		SetData(renderer, &white, sizeof(white));
+	}
+
+	void VulkanImage::CreateImageFromContainer(const RendererID renderer, const std::filesystem::path& imagePath)
+	{
+		LU_PROFILE("VkImage::CreateImageFromContainer()");
+		ImageLayout desiredLayout = m_ImageSpecification.Layout;
+
+		// Note: These are runtime checks since the file comes from disk, a bad file shouldn't take down Dist builds
+		MappedFile file;
+		if (!file.Open(imagePath)) [[unlikely]]
+		{
+			LU_LOG_CAT(Error, IO, "[VkImage] Failed to open image container '{0}', using a placeholder instead.", imagePath.string());
+			CreatePlaceholder(renderer);
+			return;
+		}
+
+		VulkanImageContainer container;
+		if (!container.Parse(file.GetSpan())) [[unlikely]]
+		{
+			LU_LOG_CAT(Error, IO, "[VkImage] Failed to parse image container '{0}', using a placeholder instead.", imagePath.string());
+			CreatePlaceholder(renderer);
+			return;
+		}
+
+		if (!VulkanContext::GetVulkanPhysicalDevice().IsFormatSupported(container.GetVkFormat(), VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT)) [[unlikely]]
+		{
+			LU_LOG_CAT(Error, IO, "[VkImage] The format of '{0}' is not supported by this device, using a placeholder instead. See Renderer::GetCompressedFormat()", imagePath.string());
+			CreatePlaceholder(renderer);
+			return;
+		}
+
+		const auto& levels = container.GetLevels();
+
+		// Note: The mip chain is pre-baked, so we use exactly the levels in the file
+		m_ImageSpecification.Width = container.GetWidth();
+		m_ImageSpecification.Height = container.GetHeight();
+		m_ImageSpecification.Format = VkFormatToImageFormat(container.GetVkFormat());
+		m_ImageSpecification.MipMaps = (levels.size() > 1);
+		m_Miplevels = static_cast<uint32_t>(levels.size());
+
+		VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(m_ImageSpecification.Usage);
+		if (IsCompressedVkFormat(container.GetVkFormat()))
+			usage &= ~(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+
+		m_Allocation = VulkanAllocator::AllocateImage(renderer, m_ImageSpecification.Width, m_ImageSpecification.Height, m_Miplevels, container.GetVkFormat(), VK_IMAGE_TILING_OPTIMAL, usage, VMA_MEMORY_USAGE_GPU_ONLY, m_Image);
+
+		m_ImageView = VulkanAllocator::CreateImageView(renderer, m_Image, container.GetVkFormat(), VK_IMAGE_ASPECT_COLOR_BIT, m_Miplevels);
+		m_Sampler = VulkanAllocator::CreateSampler(renderer, FilterModeToVkFilter(m_SamplerSpecification.MagFilter), FilterModeToVkFilter(m_SamplerSpecification.MinFilter), AddressModeToVkSamplerAddressMode(m_SamplerSpecification.Address), MipmapModeToVkSamplerMipmapMode(m_SamplerSpecification.Mipmaps), m_Miplevels);
+
+		// Copy every level straight from the mapped file into the staging buffer
+		VkDeviceSize stagingSize = 0;
+		for (const auto& level : levels)
+			stagingSize += level.Size;
+
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+		VmaAllocation stagingAllocation = VulkanAllocator::AllocateBuffer(renderer, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY, stagingBuffer);
+
+		void* mappedData = nullptr;
+		VulkanAllocator::MapMemory(stagingAllocation, mappedData);
+
+		std::vector<VkBufferImageCopy> regions(levels.size());
+		VkDeviceSize offset = 0;
+		for (size_t i = 0; i < levels.size(); i++)
+		{
+			std::memcpy(static_cast<uint8_t*>(mappedData) + offset, file.GetData() + levels[i].Offset, levels[i].Size);
+
+			VkBufferImageCopy& region = regions[i];
+			region.bufferOffset = offset;
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.mipLevel = static_cast<uint32_t>(i);
+			region.imageSubresource.baseArrayLayer = 0;
+			region.imageSubresource.layerCount = 1;
+			region.imageOffset = { 0, 0, 0 };
+			region.imageExtent = { levels[i].Width, levels[i].Height, 1 };
+
+			offset += levels[i].Size;
+		}
+
+		VulkanAllocator::UnMapMemory(stagingAllocation);
+		file.Close();
+
+		// Upload all levels at once
+		{
+			VulkanCommand command(renderer, true);
+			RecordUpload(command.GetVkCommandBuffer(), stagingBuffer, regions);
+			command.EndAndSubmit();
+		}
+
+		VulkanAllocator::DestroyBuffer(renderer, stagingBuffer, stagingAllocation);
+		Transition(renderer, ImageLayout::ShaderRead, desiredLayout);
+	}
+
 	void VulkanImage::GenerateMipmaps(const RendererID renderer, VkImage& image, VkFormat imageFormat, int32_t texWidth, int32_t texHeight, uint32_t mipLevels)
 	{
 		// Check if there a no mipmaps
@@ -406,7 +749,17 @@ namespace Lunar::Internal
 		LU_VERIFY((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT), "[VulkanImage] Texture image format does not support linear blitting!");
 
 		VulkanCommand command = VulkanCommand(renderer, true);
+		RecordMipmaps(command.GetVkCommandBuffer(), image, imageFormat, texWidth, texHeight, mipLevels);
+		command.EndAndSubmit();
+
+		// Generating the mipmaps sets the image layout to 
+		// ShaderRead, but ofcourse doesn't automatically set the 
+		// specification layout. So we do it here manually.
+		m_ImageSpecification.Layout = ImageLayout::ShaderRead;
+	}
 
+	void VulkanImage::RecordMipmaps(VkCommandBuffer commandBuffer, VkImage& image, VkFormat, int32_t texWidth, int32_t texHeight, uint32_t mipLevels)
+	{
 		VkImageMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 		barrier.image = image;
@@ -428,7 +781,7 @@ namespace Lunar::Internal
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 
-			vkCmdPipelineBarrier(command.GetVkCommandBuffer(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 
 			VkImageBlit blit = {};
 			blit.srcOffsets[0] = { 0, 0, 0 };
@@ -444,14 +797,14 @@ namespace Lunar::Internal
 			blit.dstSubresource.baseArrayLayer = 0;
 			blit.dstSubresource.layerCount = 1;
 
-			vkCmdBlitImage(command.GetVkCommandBuffer(), image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+			vkCmdBlitImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
 
 			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
 			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
-			vkCmdPipelineBarrier(command.GetVkCommandBuffer(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 
 			if (mipWidth > 1) mipWidth /= 2;
 			if (mipHeight > 1) mipHeight /= 2;
@@ -463,35 +816,113 @@ namespace Lunar::Internal
 		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
-		vkCmdPipelineBarrier(command.GetVkCommandBuffer(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+	}
 
-		command.EndAndSubmit();
+	void VulkanImage::RecordUpload(VkCommandBuffer commandBuffer, VkBuffer stagingBuffer, const std::vector<VkBufferImageCopy>& regions)
+	{
+		VkImageMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.srcAccessMask = 0;
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.image = m_Image;
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.baseMipLevel = 0;
+		barrier.subresourceRange.levelCount = m_Miplevels;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = 1;
+
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+
+		if (regions.size() < m_Miplevels)
+		{
+			RecordMipmaps(commandBuffer, m_Image, ImageFormatToVkFormat(m_ImageSpecification.Format), m_ImageSpecification.Width, m_ImageSpecification.Height, m_Miplevels);
+		}
+		else
+		{
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+		}
 
-		// Generating the mipmaps sets the image layout to 
-		// ShaderRead, but ofcourse doesn't automatically set the 
-		// specification layout. So we do it here manually.
 		m_ImageSpecification.Layout = ImageLayout::ShaderRead;
 	}
 
-	void VulkanImage::DestroyImage(const RendererID renderer)
+	std::vector<VkBufferImageCopy> VulkanImage::GetLevelRegions(VkDeviceSize offset, uint32_t levels) const
 	{
-		VulkanRenderer::GetRenderer(renderer).Free([renderer = renderer, sampler = m_Sampler, imageView = m_ImageView, image = m_Image, allocation = m_Allocation]()
+		const VkFormat format = ImageFormatToVkFormat(m_ImageSpecification.Format);
+		std::vector<VkBufferImageCopy> regions(levels);
+
+		for (uint32_t i = 0; i < levels; i++)
 		{
-			auto device = VulkanContext::GetVulkanDevice().GetVkDevice();
+			const uint32_t width = std::max(m_ImageSpecification.Width >> i, 1u);
+			const uint32_t height = std::max(m_ImageSpecification.Height >> i, 1u);
+
+			VkBufferImageCopy& region = regions[i];
+			region.bufferOffset = offset;
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.mipLevel = i;
+			region.imageSubresource.baseArrayLayer = 0;
+			region.imageSubresource.layerCount = 1;
+			region.imageOffset = { 0, 0, 0 };
+			region.imageExtent = { width, height, 1 };
+
+			offset += GetVkFormatLevelSize(format, width, height);
+		}
 
-			if (sampler)
-				vkDestroySampler(device, sampler, nullptr);
-			if (imageView)
-				vkDestroyImageView(device, imageView, nullptr);
+		return regions;
+	}
 
-			if (image != VK_NULL_HANDLE && allocation != VK_NULL_HANDLE)
-				VulkanAllocator::DestroyImage(renderer, image, allocation);
-		});
+	void VulkanImage::DestroyImage(const RendererID renderer)
+	{
+		VulkanRenderer& vkRenderer = VulkanRenderer::GetRenderer(renderer);
+
+		if (m_Sampler)
+			vkRenderer.Free(m_Sampler);
+		if (m_ImageView)
+			vkRenderer.Free(m_ImageView);
+
+		// Note: Swapchain images don't have an allocation, they are owned by the swapchain
+		if (m_Image != VK_NULL_HANDLE && m_Allocation != VK_NULL_HANDLE)
+			vkRenderer.Free(m_Image, m_Allocation);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Static methods
 	////////////////////////////////////////////////////////////////////////////////////
+	uint8_t* VulkanImage::LoadPixels(const std::filesystem::path& imagePath, uint32_t& width, uint32_t& height)
+	{
+		int texWidth, texHeight, texChannels;
+
+		// Note: The thread variant, since the global flag is shared with every other decoding thread
+		stbi_set_flip_vertically_on_load_thread(1);
+		stbi_uc* pixels = stbi_load(imagePath.string().c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+
+		if (pixels == nullptr)
+		{
+			LU_LOG_CAT(Error, Vulkan, "[VkImage] Failed to load image from '{0}'", imagePath.string());
+			return nullptr;
+		}
+
+		width = static_cast<uint32_t>(texWidth);
+		height = static_cast<uint32_t>(texHeight);
+		return static_cast<uint8_t*>(pixels);
+	}
+
+	void VulkanImage::FreePixels(uint8_t* pixels)
+	{
+		stbi_image_free(static_cast<void*>(pixels));
+	}
+
 	static VkImageAspectFlags GetVulkanImageAspectFromImageUsage(VkImageUsageFlags usage)
 	{
 		VkImageAspectFlags flags = 0;
@@ -662,6 +1093,24 @@ namespace Lunar::Internal
 		case VK_FORMAT_D32_SFLOAT_S8_UINT:										return ImageFormat::Depth32SFloatS8;
 		case VK_FORMAT_D24_UNORM_S8_UINT:										return ImageFormat::Depth24UnormS8;
 
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:									return ImageFormat::BC1;
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:										return ImageFormat::BC1sRGB;
+		case VK_FORMAT_BC2_UNORM_BLOCK:											return ImageFormat::BC2;
+		case VK_FORMAT_BC2_SRGB_BLOCK:											return ImageFormat::BC2sRGB;
+		case VK_FORMAT_BC3_UNORM_BLOCK:											return ImageFormat::BC3;
+		case VK_FORMAT_BC3_SRGB_BLOCK:											return ImageFormat::BC3sRGB;
+		case VK_FORMAT_BC4_UNORM_BLOCK:											return ImageFormat::BC4;
+		case VK_FORMAT_BC5_UNORM_BLOCK:											return ImageFormat::BC5;
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:										return ImageFormat::BC6H;
+		case VK_FORMAT_BC7_UNORM_BLOCK:											return ImageFormat::BC7;
+		case VK_FORMAT_BC7_SRGB_BLOCK:											return ImageFormat::BC7sRGB;
+		case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:								return ImageFormat::ETC2RGBA;
+		case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:								return ImageFormat::ETC2RGBAsRGB;
+		case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:									return ImageFormat::ASTC4x4;
+		case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:										return ImageFormat::ASTC4x4sRGB;
+		case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:									return ImageFormat::ASTC8x8;
+		case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:										return ImageFormat::ASTC8x8sRGB;
+
 		default:
 			LU_ASSERT(false, "[VulkanImage] Format not implemented.");
 			break;
@@ -682,6 +1131,24 @@ namespace Lunar::Internal
 		case ImageFormat::Depth32SFloatS8:										return VK_FORMAT_D32_SFLOAT_S8_UINT;
 		case ImageFormat::Depth24UnormS8:										return VK_FORMAT_D24_UNORM_S8_UINT;
 
+		case ImageFormat::BC1:													return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+		case ImageFormat::BC1sRGB:												return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+		case ImageFormat::BC2:													return VK_FORMAT_BC2_UNORM_BLOCK;
+		case ImageFormat::BC2sRGB:												return VK_FORMAT_BC2_SRGB_BLOCK;
+		case ImageFormat::BC3:													return VK_FORMAT_BC3_UNORM_BLOCK;
+		case ImageFormat::BC3sRGB:												return VK_FORMAT_BC3_SRGB_BLOCK;
+		case ImageFormat::BC4:													return VK_FORMAT_BC4_UNORM_BLOCK;
+		case ImageFormat::BC5:													return VK_FORMAT_BC5_UNORM_BLOCK;
+		case ImageFormat::BC6H:													return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+		case ImageFormat::BC7:													return VK_FORMAT_BC7_UNORM_BLOCK;
+		case ImageFormat::BC7sRGB:												return VK_FORMAT_BC7_SRGB_BLOCK;
+		case ImageFormat::ETC2RGBA:												return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+		case ImageFormat::ETC2RGBAsRGB:											return VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK;
+		case ImageFormat::ASTC4x4:												return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+		case ImageFormat::ASTC4x4sRGB:											return VK_FORMAT_ASTC_4x4_SRGB_BLOCK;
+		case ImageFormat::ASTC8x8:												return VK_FORMAT_ASTC_8x8_UNORM_BLOCK;
+		case ImageFormat::ASTC8x8sRGB:											return VK_FORMAT_ASTC_8x8_SRGB_BLOCK;
+
 		default:
 			LU_ASSERT(false, "[VulkanImage] Format not implemented.");
 			break;
@@ -788,4 +1255,64 @@ namespace Lunar::Internal
 		return VK_SAMPLER_MIPMAP_MODE_NEAREST;
 	}
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Format functions
+	////////////////////////////////////////////////////////////////////////////////////
+	VulkanFormatBlock GetVkFormatBlock(VkFormat format)
+	{
+		switch (format)
+		{
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_D32_SFLOAT:
+		case VK_FORMAT_D24_UNORM_S8_UINT:										return { 1, 1, 4 };
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:										return { 1, 1, 8 };
+
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		case VK_FORMAT_BC4_UNORM_BLOCK:											return { 4, 4, 8 };
+
+		case VK_FORMAT_BC2_UNORM_BLOCK:
+		case VK_FORMAT_BC2_SRGB_BLOCK:
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+		case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+		case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:										return { 4, 4, 16 };
+
+		case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+		case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:										return { 8, 8, 16 };
+
+		default:
+			LU_ASSERT(false, "[VulkanImage] Format not implemented.");
+			break;
+		}
+
+		return {};
+	}
+
+	bool IsCompressedVkFormat(VkFormat format)
+	{
+		VulkanFormatBlock block = GetVkFormatBlock(format);
+		return (block.Width > 1 || block.Height > 1);
+	}
+
+	size_t GetVkFormatRowPitch(VkFormat format, uint32_t width)
+	{
+		VulkanFormatBlock block = GetVkFormatBlock(format);
+		return static_cast<size_t>((width + block.Width - 1) / block.Width) * block.Size;
+	}
+
+	size_t GetVkFormatLevelSize(VkFormat format, uint32_t width, uint32_t height)
+	{
+		VulkanFormatBlock block = GetVkFormatBlock(format);
+		return GetVkFormatRowPitch(format, width) * ((height + block.Height - 1) / block.Height);
+	}
+
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "Lunar/Internal/Renderer/RendererSpec.hpp"
 #include "Lunar/Internal/Renderer/ImageSpec.hpp"
 
+#include <vector>
+#include <memory>
 #include <filesystem>
 
 namespace Lunar::Internal
@@ -12,6 +14,8 @@ namespace Lunar::Internal
 
     class VulkanSwapChain;
     class VulkanDescriptorSet;
+    class VulkanImageStreamer;
+    struct VulkanImageStreamRequest;
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Convert functions
@@ -30,6 +34,23 @@ namespace Lunar::Internal
 	MipmapMode VkSamplerMipmapModeToMipmapMode(VkSamplerMipmapMode mode);
 	VkSamplerMipmapMode MipmapModeToVkSamplerMipmapMode(MipmapMode mode);
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Format functions
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct VulkanFormatBlock
+    {
+    public:
+        uint32_t Width = 1;  // In texels
+        uint32_t Height = 1; // In texels
+        uint32_t Size = 4;   // In bytes
+    };
+
+    VulkanFormatBlock GetVkFormatBlock(VkFormat format);
+    bool IsCompressedVkFormat(VkFormat format);
+
+    size_t GetVkFormatRowPitch(VkFormat format, uint32_t width); // Note: In bytes, for compressed formats this is a row of blocks
+    size_t GetVkFormatLevelSize(VkFormat format, uint32_t width, uint32_t height);
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanImage
     ////////////////////////////////////////////////////////////////////////////////////
@@ -40,14 +61,25 @@ namespace Lunar::Internal
         VulkanImage() = default;
         ~VulkanImage() = default;
 
+        // Copying & Moving
+        // Note: Copies share the handles but don't track a pending InitAsync load, they keep the handles they were copied with
+        VulkanImage(const VulkanImage& other);
+        VulkanImage& operator = (const VulkanImage& other);
+
+        // Note: A pending InitAsync load follows the image, so only move on the thread that calls Renderer::BeginFrame
+        VulkanImage(VulkanImage&& other) noexcept;
+        VulkanImage& operator = (VulkanImage&& other) noexcept;
+
 		// Init & Destroy
         void Init(const RendererID renderer, const ImageSpecification& imageSpecs, const SamplerSpecification& samplerSpecs);
         void Init(const RendererID renderer, const ImageSpecification& imageSpecs, const SamplerSpecification& samplerSpecs, const std::filesystem::path& imagePath);
         void Init(const RendererID renderer, const ImageSpecification& imageSpecs, const VkImage image, const VkImageView imageView); // Note: This exists for swapchain images
+        void InitAsync(const RendererID renderer, const ImageSpecification& imageSpecs, const SamplerSpecification& samplerSpecs, const std::filesystem::path& imagePath); // Note: Decodes on a worker thread, the image is uploaded in a later BeginFrame
         void Destroy(const RendererID renderer);
 
         // Methods
         void SetData(const RendererID renderer, void* data, size_t size);
+        void GetData(const RendererID renderer, std::vector<uint8_t>& data, ImageLayout current); // Note: Blocks until the copy finished, the image is left in the current layout
 
         void Resize(const RendererID renderer, uint32_t width, uint32_t height);
 
@@ -60,19 +92,33 @@ namespace Lunar::Internal
         inline uint32_t GetWidth() const { return m_ImageSpecification.Width; }
         inline uint32_t GetHeight() const { return m_ImageSpecification.Height; }
 
+        inline bool IsLoaded() const { return (m_StreamRequest == nullptr) && !m_LoadFailed; }
+        inline bool HasFailed() const { return m_LoadFailed; } // Note: An InitAsync load that failed, the image has no GPU resources
+
         // Internal getters
         inline VkImage GetVkImage() const { return m_Image; }
         inline VmaAllocation GetVmaAllocation() const { return m_Allocation; }
         inline VkImageView GetVkImageView() const { return m_ImageView; }
         inline VkSampler GetVkSampler() const { return m_Sampler; }
+        inline bool IsAliased() const { return m_Aliased; } // Note: A render target whose memory was used by another target earlier this frame
 
     private:
         // Private methods
         void CreateImage(const RendererID renderer, uint32_t width, uint32_t height);
         void CreateImage(const RendererID renderer, const std::filesystem::path& imagePath);
+        void CreateImageFromContainer(const RendererID renderer, const std::filesystem::path& imagePath);
+        void CreatePlaceholder(const RendererID renderer); // Note: Used when an image file can't be loaded
         void GenerateMipmaps(const RendererID renderer, VkImage& image, VkFormat imageFormat, int32_t texWidth, int32_t texHeight, uint32_t mipLevels);
+        void RecordMipmaps(VkCommandBuffer commandBuffer, VkImage& image, VkFormat imageFormat, int32_t texWidth, int32_t texHeight, uint32_t mipLevels);
+        void RecordUpload(VkCommandBuffer commandBuffer, VkBuffer stagingBuffer, const std::vector<VkBufferImageCopy>& regions); // Note: Blits the missing mips if only the base level is passed in, leaves the image in ShaderRead
+        void RecordTransition(const RendererID renderer, VkCommandBuffer commandBuffer, ImageLayout initial, ImageLayout final);
+        std::vector<VkBufferImageCopy> GetLevelRegions(VkDeviceSize offset, uint32_t levels) const; // Note: For tightly packed levels, see MipChain
         void DestroyImage(const RendererID renderer);
 
+        // Static methods
+        static uint8_t* LoadPixels(const std::filesystem::path& imagePath, uint32_t& width, uint32_t& height); // Note: Thread-safe, always returns RGBA
+        static void FreePixels(uint8_t* pixels);
+
     private:
         ImageSpecification m_ImageSpecification = {};
         SamplerSpecification m_SamplerSpecification = {};
@@ -84,8 +130,14 @@ namespace Lunar::Internal
 
         uint32_t m_Miplevels = 1;
 
+        std::shared_ptr<VulkanImageStreamRequest> m_StreamRequest = nullptr; // Note: Only set while an InitAsync load is pending
+        bool m_LoadFailed = false;
+        bool m_Aliased = false; // Note: Set by the VulkanRenderTargetPool on every Acquire
+
         friend class VulkanSwapChain;
         friend class VulkanDescriptorSet;
+        friend class VulkanImageStreamer;
+        friend class VulkanRenderTargetPool;
     };
 
 }
\ No newline at end of file
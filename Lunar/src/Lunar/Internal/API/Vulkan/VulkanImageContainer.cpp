@@ -0,0 +1,333 @@
+#include "lupch.h"
+#include "VulkanImageContainer.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanImage.hpp"
+
+#include <bit>
+#include <cctype>
+#include <cstring>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        static constexpr const uint8_t s_KTX2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+        static constexpr uint32_t MakeFourCC(const char (&code)[5]) { return static_cast<uint32_t>(code[0]) | (static_cast<uint32_t>(code[1]) << 8) | (static_cast<uint32_t>(code[2]) << 16) | (static_cast<uint32_t>(code[3]) << 24); }
+
+        static constexpr const uint32_t s_DDSMagic = MakeFourCC("DDS ");
+        static constexpr const uint32_t s_DX10FourCC = MakeFourCC("DX10");
+
+        template<typename T>
+        static T Read(std::span<const uint8_t> data, size_t offset)
+        {
+            T value = {};
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            return value;
+        }
+
+        // Note: A full chain of a width x height image has bit_width(max(width, height)) levels,
+        // anything above that is a malformed file (and would shift by >= 32 below)
+        static bool IsValidLevelCount(uint32_t width, uint32_t height, uint32_t levels)
+        {
+            return (levels <= static_cast<uint32_t>(std::bit_width(std::max(width, height))));
+        }
+    }
+
+    static bool IsSupportedFormat(VkFormat format);
+    static VkFormat DXGIFormatToVkFormat(uint32_t format);
+    static VkFormat FourCCToVkFormat(uint32_t fourCC);
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool VulkanImageContainer::Parse(std::span<const uint8_t> data)
+    {
+        m_Levels.clear();
+
+        if (data.size() >= sizeof(s_KTX2Identifier) && std::memcmp(data.data(), s_KTX2Identifier, sizeof(s_KTX2Identifier)) == 0)
+            return ParseKTX2(data);
+        if (data.size() >= sizeof(uint32_t) && Read<uint32_t>(data, 0) == s_DDSMagic)
+            return ParseDDS(data);
+
+        LU_LOG_CAT(Error, IO, "[VkImageContainer] Data is neither a KTX2 nor a DDS file.");
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool VulkanImageContainer::IsContainer(const std::filesystem::path& path)
+    {
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+
+        return (extension == ".ktx2" || extension == ".dds");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool VulkanImageContainer::ParseKTX2(std::span<const uint8_t> data)
+    {
+        // Identifier (12) + header (36) + index (32)
+        constexpr const size_t levelIndexOffset = 80;
+        if (data.size() < levelIndexOffset)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] KTX2 header is truncated.");
+            return false;
+        }
+
+        const VkFormat format = static_cast<VkFormat>(Read<uint32_t>(data, 12));
+        const uint32_t width = Read<uint32_t>(data, 20);
+        const uint32_t height = Read<uint32_t>(data, 24);
+        const uint32_t depth = Read<uint32_t>(data, 28);
+        const uint32_t layers = Read<uint32_t>(data, 32);
+        const uint32_t faces = Read<uint32_t>(data, 36);
+        const uint32_t levels = std::max(Read<uint32_t>(data, 40), 1u); // Note: 0 means the mips should be generated at runtime
+        const uint32_t supercompression = Read<uint32_t>(data, 44);
+
+        if (depth > 1 || layers > 1 || faces != 1 || width == 0 || height == 0)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] Only 2D KTX2 images are supported.");
+            return false;
+        }
+        if (width > MaxDimension || height > MaxDimension)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] KTX2 image is too large ({0}x{1}), the maximum is {2}x{2}.", width, height, MaxDimension);
+            return false;
+        }
+        if (!IsValidLevelCount(width, height, levels))
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] KTX2 image has more levels ({0}) than a {1}x{2} image can have.", levels, width, height);
+            return false;
+        }
+        if (supercompression != 0)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] Supercompressed KTX2 images are not supported.");
+            return false;
+        }
+        if (!IsSupportedFormat(format))
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] KTX2 image has an unsupported format ({0}).", static_cast<uint32_t>(format));
+            return false;
+        }
+        if (data.size() < levelIndexOffset + (levels * 24ull))
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] KTX2 level index is truncated.");
+            return false;
+        }
+
+        m_Format = format;
+        m_Width = width;
+        m_Height = height;
+        m_Levels.resize(levels);
+
+        // Note: The level index always starts with the base level
+        for (uint32_t i = 0; i < levels; i++)
+        {
+            Level& level = m_Levels[i];
+            level.Offset = static_cast<size_t>(Read<uint64_t>(data, levelIndexOffset + (i * 24ull)));
+            level.Size = static_cast<size_t>(Read<uint64_t>(data, levelIndexOffset + (i * 24ull) + 8));
+            level.Width = std::max(width >> i, 1u);
+            level.Height = std::max(height >> i, 1u);
+
+            // Note: Offset & size come straight from the file, so the check can't add them (that could wrap around)
+            if (level.Offset > data.size() || level.Size > data.size() - level.Offset || level.Size < GetVkFormatLevelSize(format, level.Width, level.Height))
+            {
+                LU_LOG_CAT(Error, IO, "[VkImageContainer] KTX2 level {0} lies outside of the file.", i);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool VulkanImageContainer::ParseDDS(std::span<const uint8_t> data)
+    {
+        // Magic (4) + header (124)
+        constexpr const size_t headerSize = 128;
+        if (data.size() < headerSize)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS header is truncated.");
+            return false;
+        }
+
+        const uint32_t height = Read<uint32_t>(data, 12);
+        const uint32_t width = Read<uint32_t>(data, 16);
+        const uint32_t levels = std::max(Read<uint32_t>(data, 28), 1u);
+
+        if (width == 0 || height == 0)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS image has no size.");
+            return false;
+        }
+        if (width > MaxDimension || height > MaxDimension)
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS image is too large ({0}x{1}), the maximum is {2}x{2}.", width, height, MaxDimension);
+            return false;
+        }
+        if (!IsValidLevelCount(width, height, levels))
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS image has more levels ({0}) than a {1}x{2} image can have.", levels, width, height);
+            return false;
+        }
+
+        const uint32_t pixelFlags = Read<uint32_t>(data, 80);
+        const uint32_t fourCC = Read<uint32_t>(data, 84);
+        const uint32_t bitCount = Read<uint32_t>(data, 88);
+        const uint32_t redMask = Read<uint32_t>(data, 92);
+
+        size_t offset = headerSize;
+        VkFormat format = VK_FORMAT_UNDEFINED;
+
+        if ((pixelFlags & 0x4) && fourCC == s_DX10FourCC) // DDPF_FOURCC
+        {
+            // Extended header (20)
+            if (data.size() < headerSize + 20)
+            {
+                LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS extended header is truncated.");
+                return false;
+            }
+
+            const uint32_t dimension = Read<uint32_t>(data, headerSize + 4);
+            const uint32_t arraySize = Read<uint32_t>(data, headerSize + 12);
+            if (dimension != 3 || arraySize > 1) // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+            {
+                LU_LOG_CAT(Error, IO, "[VkImageContainer] Only 2D DDS images are supported.");
+                return false;
+            }
+
+            format = DXGIFormatToVkFormat(Read<uint32_t>(data, headerSize));
+            offset += 20;
+        }
+        else if (pixelFlags & 0x4) // DDPF_FOURCC
+        {
+            format = FourCCToVkFormat(fourCC);
+        }
+        else if ((pixelFlags & 0x40) && bitCount == 32) // DDPF_RGB
+        {
+            format = (redMask == 0x000000FF ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_B8G8R8A8_UNORM);
+        }
+
+        if (!IsSupportedFormat(format))
+        {
+            LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS image has an unsupported format.");
+            return false;
+        }
+
+        m_Format = format;
+        m_Width = width;
+        m_Height = height;
+        m_Levels.resize(levels);
+
+        // Note: DDS levels are tightly packed after the header(s)
+        for (uint32_t i = 0; i < levels; i++)
+        {
+            Level& level = m_Levels[i];
+            level.Width = std::max(width >> i, 1u);
+            level.Height = std::max(height >> i, 1u);
+            level.Offset = offset;
+            level.Size = GetVkFormatLevelSize(format, level.Width, level.Height);
+
+            if (level.Offset > data.size() || level.Size > data.size() - level.Offset)
+            {
+                LU_LOG_CAT(Error, IO, "[VkImageContainer] DDS level {0} lies outside of the file.", i);
+                return false;
+            }
+
+            offset += level.Size;
+        }
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    static bool IsSupportedFormat(VkFormat format)
+    {
+        switch (format)
+        {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+        case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+        case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
+            return true;
+
+        default:
+            break;
+        }
+
+        return false;
+    }
+
+    static VkFormat DXGIFormatToVkFormat(uint32_t format)
+    {
+        // Note: The values of DXGI_FORMAT
+        switch (format)
+        {
+        case 28:                                                                return VK_FORMAT_R8G8B8A8_UNORM;
+        case 29:                                                                return VK_FORMAT_R8G8B8A8_SRGB;
+        case 87:                                                                return VK_FORMAT_B8G8R8A8_UNORM;
+        case 71:                                                                return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case 72:                                                                return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case 74:                                                                return VK_FORMAT_BC2_UNORM_BLOCK;
+        case 75:                                                                return VK_FORMAT_BC2_SRGB_BLOCK;
+        case 77:                                                                return VK_FORMAT_BC3_UNORM_BLOCK;
+        case 78:                                                                return VK_FORMAT_BC3_SRGB_BLOCK;
+        case 80:                                                                return VK_FORMAT_BC4_UNORM_BLOCK;
+        case 83:                                                                return VK_FORMAT_BC5_UNORM_BLOCK;
+        case 95:                                                                return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case 98:                                                                return VK_FORMAT_BC7_UNORM_BLOCK;
+        case 99:                                                                return VK_FORMAT_BC7_SRGB_BLOCK;
+
+        default:
+            break;
+        }
+
+        return VK_FORMAT_UNDEFINED;
+    }
+
+    static VkFormat FourCCToVkFormat(uint32_t fourCC)
+    {
+        // Note: Legacy (pre DX10 header) compressed formats
+        switch (fourCC)
+        {
+        case MakeFourCC("DXT1"):                                                return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case MakeFourCC("DXT3"):                                                return VK_FORMAT_BC2_UNORM_BLOCK;
+        case MakeFourCC("DXT5"):                                                return VK_FORMAT_BC3_UNORM_BLOCK;
+        case MakeFourCC("ATI1"):
+        case MakeFourCC("BC4U"):                                                return VK_FORMAT_BC4_UNORM_BLOCK;
+        case MakeFourCC("ATI2"):
+        case MakeFourCC("BC5U"):                                                return VK_FORMAT_BC5_UNORM_BLOCK;
+
+        default:
+            break;
+        }
+
+        return VK_FORMAT_UNDEFINED;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <filesystem>
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanImageContainer
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Parses KTX2 & DDS files holding pre-baked 2D mip chains. Nothing is copied,
+    // the levels are offsets into the (memory mapped) file data that was passed in.
+    // Note: The levels are uploaded as-is, block compressed data can't be flipped cheaply on load.
+    // To match images loaded through stb (which are flipped) the files must be authored with
+    // their first row at the bottom, e.g. `toktx --lower_left_maps_to_s0t0` or `texconv -vflip`.
+    class VulkanImageContainer
+    {
+    public:
+        struct Level
+        {
+        public:
+            size_t Offset = 0;
+            size_t Size = 0;
+
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+        };
+    public:
+        constexpr static const uint32_t MaxDimension = 32768; // Note: Larger files are rejected, keeps the level size math far from overflowing
+    public:
+        // Constructor & Destructor
+        VulkanImageContainer() = default;
+        ~VulkanImageContainer() = default;
+
+        // Methods
+        bool Parse(std::span<const uint8_t> data); // Note: Returns false on unsupported or malformed files
+
+        // Getters
+        inline VkFormat GetVkFormat() const { return m_Format; }
+        inline uint32_t GetWidth() const { return m_Width; }
+        inline uint32_t GetHeight() const { return m_Height; }
+        inline const std::vector<Level>& GetLevels() const { return m_Levels; }
+
+        // Static methods
+        static bool IsContainer(const std::filesystem::path& path); // Note: Checks the extension
+
+    private:
+        // Private methods
+        bool ParseKTX2(std::span<const uint8_t> data);
+        bool ParseDDS(std::span<const uint8_t> data);
+
+    private:
+        VkFormat m_Format = VK_FORMAT_UNDEFINED;
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+
+        std::vector<Level> m_Levels = { };
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "lupch.h"
+#include "VulkanImageStreamer.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include "Lunar/Internal/Renderer/MipChain.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanImage.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanAllocator.hpp"
+
+#include <cstring>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    static VkDeviceSize GetUploadSize(const VulkanImageStreamRequest& request)
+    {
+        if (!request.Levels.empty())
+            return static_cast<VkDeviceSize>(request.Levels.size());
+
+        return static_cast<VkDeviceSize>(request.Width) * request.Height * 4;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanImageStreamer::Init(const RendererID rendererID)
+    {
+        m_RendererID = rendererID;
+        m_Workers.Init();
+    }
+
+    void VulkanImageStreamer::Destroy()
+    {
+        m_Workers.Destroy();
+
+        for (auto& request : m_Decoded)
+        {
+            if (request->Levels.empty())
+                VulkanImage::FreePixels(request->Pixels);
+        }
+
+        m_Decoded.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<VulkanImageStreamRequest> VulkanImageStreamer::Load(VulkanImage& target, const std::filesystem::path& path)
+    {
+        std::shared_ptr<VulkanImageStreamRequest> request = std::make_shared<VulkanImageStreamRequest>();
+        request->Target = &target;
+        request->Path = path;
+        request->GenerateMipmaps = (target.m_ImageSpecification.MipMaps && target.m_ImageSpecification.MipMapGeneration == MipmapGeneration::CPU);
+
+        m_Workers.Push([this, request]()
+        {
+            LU_PROFILE("VkImageStreamer::Decode");
+            if (request->Cancelled)
+                return;
+
+            request->Pixels = VulkanImage::LoadPixels(request->Path, request->Width, request->Height);
+
+            if (request->Pixels && request->GenerateMipmaps && !request->Cancelled)
+            {
+                request->Levels.resize(MipChain::GetSize(request->Width, request->Height));
+                MipChain::Generate(request->Pixels, request->Width, request->Height, request->Levels.data());
+
+                VulkanImage::FreePixels(request->Pixels);
+                request->Pixels = request->Levels.data();
+            }
+
+            std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+            m_Decoded.push_back(request);
+        });
+
+        return request;
+    }
+
+    void VulkanImageStreamer::Update()
+    {
+        std::vector<std::shared_ptr<VulkanImageStreamRequest>> requests = { };
+        {
+            std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+            if (m_Decoded.empty())
+                return;
+
+            requests.swap(m_Decoded);
+        }
+
+        LU_PROFILE("VkImageStreamer::Update()");
+
+        // Note: Failed loads are marked as such, so they keep drawing as the placeholder (IsLoaded() stays false)
+        VkDeviceSize stagingSize = 0;
+        for (auto& request : requests)
+        {
+            if (request->Cancelled)
+                continue;
+
+            if (request->Pixels == nullptr)
+            {
+                LU_LOG_CAT(Error, IO, "[VkImageStreamer] Failed to stream in '{0}', the image keeps using its placeholder.", request->Path.string());
+
+                request->Target->m_StreamRequest.reset();
+                request->Target->m_LoadFailed = true;
+                request->Cancelled = true;
+                continue;
+            }
+
+            stagingSize += GetUploadSize(*request);
+        }
+
+        if (stagingSize > 0)
+        {
+            VkBuffer stagingBuffer = VK_NULL_HANDLE;
+            VmaAllocation stagingAllocation = VulkanAllocator::AllocateBuffer(m_RendererID, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY, stagingBuffer);
+
+            void* mappedData = nullptr;
+            VulkanAllocator::MapMemory(stagingAllocation, mappedData);
+
+            VulkanCommand command(m_RendererID, true);
+
+            // Note: The final layout transitions are recorded into the same command, so everything is a single submit
+            VkDeviceSize offset = 0;
+            for (auto& request : requests)
+            {
+                if (request->Cancelled)
+                    continue;
+
+                const VkDeviceSize size = GetUploadSize(*request);
+                std::memcpy(static_cast<uint8_t*>(mappedData) + offset, request->Pixels, static_cast<size_t>(size));
+
+                VulkanImage& image = *request->Target;
+                const ImageLayout desiredLayout = image.m_ImageSpecification.Layout;
+
+                image.m_ImageSpecification.Format = ImageFormat::RGBA;
+                image.CreateImage(m_RendererID, request->Width, request->Height);
+                image.RecordUpload(command.GetVkCommandBuffer(), stagingBuffer, image.GetLevelRegions(offset, (request->Levels.empty() ? 1 : image.m_Miplevels)));
+                image.RecordTransition(m_RendererID, command.GetVkCommandBuffer(), ImageLayout::ShaderRead, desiredLayout);
+
+                offset += size;
+            }
+
+            VulkanAllocator::UnMapMemory(stagingAllocation);
+            command.EndAndSubmit();
+
+            VulkanAllocator::DestroyBuffer(m_RendererID, stagingBuffer, stagingAllocation);
+
+            // Swap the real images in
+            for (auto& request : requests)
+            {
+                if (!request->Cancelled)
+                    request->Target->m_StreamRequest.reset();
+            }
+        }
+
+        for (auto& request : requests)
+        {
+            if (request->Levels.empty())
+                VulkanImage::FreePixels(request->Pixels);
+        }
+    }
+
+}
\ No newline at end of file
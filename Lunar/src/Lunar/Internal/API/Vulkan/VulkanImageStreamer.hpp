@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <filesystem>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+#include "Lunar/Internal/Utils/ThreadPool.hpp"
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    class VulkanImage;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanImageStreamRequest
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct VulkanImageStreamRequest
+    {
+    public:
+        VulkanImage* Target = nullptr; // Note: Kept up to date when the image is moved
+        std::filesystem::path Path = {};
+
+        bool GenerateMipmaps = false; // On the worker thread, see MipmapGeneration::CPU
+        std::atomic<bool> Cancelled = false; // Set when the target is destroyed before the load finished
+
+        // Note: Written by the worker thread, only read after it has been handed back to the streamer
+        uint8_t* Pixels = nullptr;
+        uint32_t Width = 0, Height = 0;
+
+        std::vector<uint8_t> Levels = { }; // The full mip chain, only used with GenerateMipmaps
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanImageStreamer
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Images are decoded on a worker pool, every image that finished decoding is 
+    // then uploaded in Update through a single staging buffer & command buffer submission.
+    class VulkanImageStreamer
+    {
+    public:
+        // Constructor & Destructor
+        VulkanImageStreamer() = default;
+        ~VulkanImageStreamer() = default;
+
+        // Init & Destroy
+        void Init(const RendererID rendererID);
+        void Destroy();
+
+        // Methods
+        std::shared_ptr<VulkanImageStreamRequest> Load(VulkanImage& target, const std::filesystem::path& path);
+        void Update(); // Note: Must be called from the thread that owns the target images
+
+    private:
+        RendererID m_RendererID = 0;
+        ThreadPool m_Workers = {};
+
+        std::mutex m_ThreadSafety = {};
+        std::vector<std::shared_ptr<VulkanImageStreamRequest>> m_Decoded = { };
+    };
+
+}
\ No newline at end of file
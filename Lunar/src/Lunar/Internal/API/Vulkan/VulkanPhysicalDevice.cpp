@@ -37,8 +37,13 @@ namespace Lunar::Internal
 			if (queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT)
 				indices.ComputeFamily = i;
 
+			// Note: Without a surface (headless) nothing is presented, so we alias the graphics queue
 			VkBool32 presentSupport = false;
-			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
+			if (surface)
+				vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
+			else
+				presentSupport = (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT);
+
 			if (presentSupport)
 				indices.PresentFamily = i;
 
@@ -103,6 +108,28 @@ namespace Lunar::Internal
         }
 
         LU_ASSERT(m_PhysicalDevice, "[VulkanPhysicalDevice] Failed to find a GPU with support for this application's required Vulkan capabilities!");
+
+        // Pick the best block-compressed format once, desktop GPUs support BC & mobile GPUs ETC2/ASTC
+        for (VkFormat format : { VK_FORMAT_BC7_UNORM_BLOCK, VK_FORMAT_ASTC_4x4_UNORM_BLOCK, VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK, VK_FORMAT_BC3_UNORM_BLOCK })
+        {
+            if (IsFormatSupported(format, VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT))
+            {
+                m_CompressedFormat = format;
+                break;
+            }
+        }
+
+        // Transient attachments can live in lazily allocated memory, which is never backed if the attachment stays on-chip
+        VkPhysicalDeviceMemoryProperties memoryProperties = {};
+        vkGetPhysicalDeviceMemoryProperties(m_PhysicalDevice, &memoryProperties);
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+        {
+            if (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT)
+            {
+                m_LazilyAllocatedMemory = true;
+                break;
+            }
+        }
     }
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -130,10 +157,21 @@ namespace Lunar::Internal
                 return format;
         }
 
-        LU_LOG_ERROR("[VulkanPhysicalDevice] Failed to find supported format!");
+        LU_LOG_CAT(Error, Vulkan, "[VulkanPhysicalDevice] Failed to find supported format!");
         return VK_FORMAT_UNDEFINED;
     }
 
+    bool VulkanPhysicalDevice::IsFormatSupported(VkFormat format, VkFormatFeatureFlags features, VkImageTiling tiling) const
+    {
+        VkFormatProperties props;
+        vkGetPhysicalDeviceFormatProperties(m_PhysicalDevice, format, &props);
+
+        if (tiling == VK_IMAGE_TILING_LINEAR)
+            return (props.linearTilingFeatures & features) == features;
+
+        return (props.optimalTilingFeatures & features) == features;
+    }
+
 	////////////////////////////////////////////////////////////////////////////////////
     // Private methods
 	////////////////////////////////////////////////////////////////////////////////////
@@ -142,9 +180,9 @@ namespace Lunar::Internal
 		QueueFamilyIndices indices = QueueFamilyIndices::Find(surface, device);
 
 		bool extensionsSupported = ExtensionsSupported(device);
-		bool swapChainAdequate = false;
+		bool swapChainAdequate = (surface == VK_NULL_HANDLE); // Note: Headless has no swapchain
 
-		if (extensionsSupported)
+		if (extensionsSupported && surface)
 		{
 			SwapChainSupportDetails swapChainSupport = SwapChainSupportDetails::Query(surface, device);
 			swapChainAdequate = !swapChainSupport.Formats.empty() && !swapChainSupport.PresentModes.empty();
@@ -51,9 +51,12 @@ namespace Lunar::Internal
         // Methods
         VkFormat FindDepthFormat() const;
         VkFormat FindSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features) const;
+        bool IsFormatSupported(VkFormat format, VkFormatFeatureFlags features, VkImageTiling tiling = VK_IMAGE_TILING_OPTIMAL) const;
 
         // Getters
         inline VkPhysicalDevice GetVkPhysicalDevice() const { return m_PhysicalDevice; }
+        inline VkFormat GetCompressedFormat() const { return m_CompressedFormat; } // Note: The best sampled block-compressed format, VK_FORMAT_UNDEFINED if there is none
+        inline bool HasLazilyAllocatedMemory() const { return m_LazilyAllocatedMemory; } // Note: Usually only tile-based (mobile) GPUs have this
         
     private:
         // Private methods
@@ -64,6 +67,8 @@ namespace Lunar::Internal
 
     private:
         VkPhysicalDevice m_PhysicalDevice = VK_NULL_HANDLE;
+        VkFormat m_CompressedFormat = VK_FORMAT_UNDEFINED;
+        bool m_LazilyAllocatedMemory = false;
     };
 
 }
\ No newline at end of file
@@ -83,13 +83,8 @@ namespace Lunar::Internal
 
     void VulkanPipeline::Destroy(const RendererID renderer)
     {
-        Renderer::GetRenderer(renderer).Free([pipeline = m_Pipeline, pipelineLayout = m_PipelineLayout]()
-        {
-            auto device = VulkanContext::GetVulkanDevice().GetVkDevice();
-
-            vkDestroyPipeline(device, pipeline, nullptr);
-            vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
-        });
+        VulkanRenderer::GetRenderer(renderer).Free(m_Pipeline);
+        VulkanRenderer::GetRenderer(renderer).Free(m_PipelineLayout);
     }
 
     void VulkanPipeline::Use(const RendererID renderer, CommandBuffer& cmdBuf, PipelineBindPoint bindPoint)
@@ -97,7 +92,9 @@ namespace Lunar::Internal
         LU_PROFILE("VkPipeline::Use()");
         VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
 
-        vkCmdBindPipeline(vkCmdBuf.GetVkCommandBuffer(VulkanRenderer::GetRenderer(renderer).GetVulkanSwapChain().GetCurrentFrame()), PipelineBindPointToVkPipelineBindPoint(bindPoint), m_Pipeline);
+        VulkanRenderer& vkRenderer = VulkanRenderer::GetRenderer(renderer);
+        vkCmdBindPipeline(vkCmdBuf.GetVkCommandBuffer(vkRenderer.GetVulkanSwapChain().GetCurrentFrame()), PipelineBindPointToVkPipelineBindPoint(bindPoint), m_Pipeline);
+        vkRenderer.AddFrameStat(FrameStat::PipelineBinds);
     }
 
     void VulkanPipeline::PushConstant(const RendererID renderer, CommandBuffer& cmdBuf, ShaderStage stage, void* data)
@@ -198,12 +195,21 @@ namespace Lunar::Internal
         colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
         colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
 
+        // Note: With dynamic rendering every colour attachment needs its own blend state
+        std::vector<VkFormat> dynamicColourFormats;
+        if (m_Specification.DynamicColourFormats.empty())
+            dynamicColourFormats.push_back(ImageFormatToVkFormat(m_Specification.DynamicColourFormat));
+        for (ImageFormat format : m_Specification.DynamicColourFormats)
+            dynamicColourFormats.push_back(ImageFormatToVkFormat(format));
+
+        std::vector<VkPipelineColorBlendAttachmentState> colorBlendAttachments(((renderpass == nullptr) ? dynamicColourFormats.size() : 1), colorBlendAttachment);
+
         VkPipelineColorBlendStateCreateInfo colorBlending = {};
         colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
         colorBlending.logicOpEnable = VK_FALSE;
         colorBlending.logicOp = VK_LOGIC_OP_COPY;
-        colorBlending.attachmentCount = 1;
-        colorBlending.pAttachments = &colorBlendAttachment;
+        colorBlending.attachmentCount = static_cast<uint32_t>(colorBlendAttachments.size());
+        colorBlending.pAttachments = colorBlendAttachments.data();
         colorBlending.blendConstants[0] = 1.0f;
         colorBlending.blendConstants[1] = 1.0f;
         colorBlending.blendConstants[2] = 1.0f;
@@ -263,12 +269,10 @@ namespace Lunar::Internal
 
         VK_VERIFY(vkCreatePipelineLayout(VulkanContext::GetVulkanDevice().GetVkDevice(), &pipelineLayoutInfo, nullptr, &m_PipelineLayout));
 
-        VkFormat dynamicColourFormat = ImageFormatToVkFormat(m_Specification.DynamicColourFormat);
-
         VkPipelineRenderingCreateInfo dynamicRenderInfo = {};
         dynamicRenderInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
-        dynamicRenderInfo.colorAttachmentCount = 1; // Note: We only support 1 attachment at the moment for dynamic rendering
-        dynamicRenderInfo.pColorAttachmentFormats = &dynamicColourFormat;
+        dynamicRenderInfo.colorAttachmentCount = static_cast<uint32_t>(dynamicColourFormats.size());
+        dynamicRenderInfo.pColorAttachmentFormats = dynamicColourFormats.data();
         dynamicRenderInfo.depthAttachmentFormat = ImageFormatToVkFormat(m_Specification.DynamicDepthFormat);
         dynamicRenderInfo.stencilAttachmentFormat = ImageFormatToVkFormat(m_Specification.DynamicStencilFormat);
 
@@ -0,0 +1,232 @@
+#include "lupch.h"
+#include "VulkanRenderTargetPool.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include "Lunar/Internal/Memory/ScratchAllocator.hpp"
+
+#include "Lunar/Internal/Renderer/Image.hpp"
+
+#include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanRenderer.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanAllocator.hpp"
+
+#include <limits>
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Defined here since Image is only forward declared in the header
+    VulkanRenderTargetPool::VulkanRenderTargetPool() = default;
+    VulkanRenderTargetPool::~VulkanRenderTargetPool() = default;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanRenderTargetPool::Init(const RendererID rendererID, uint32_t frameCount)
+    {
+        m_RendererID = rendererID;
+        m_Frames.resize(frameCount);
+    }
+
+    void VulkanRenderTargetPool::Destroy()
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        for (auto& frame : m_Frames)
+        {
+            for (auto& target : frame.Targets)
+                DestroyTarget(target);
+            for (auto& block : frame.Blocks)
+                vmaFreeMemory(VulkanAllocator::s_Allocator, block.Allocation);
+        }
+
+        m_Frames.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    Image* VulkanRenderTargetPool::Acquire(ImageFormat format, uint32_t width, uint32_t height, ImageUsage usage)
+    {
+        LU_PROFILE("VkRenderTargetPool::Acquire()");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        Frame& frame = m_Frames[VulkanRenderer::GetRenderer(m_RendererID).GetVulkanSwapChain().GetCurrentFrame()];
+
+        // Reuse a target that was created with the same key, as long as its memory isn't taken this frame
+        auto it = std::find_if(frame.Targets.begin(), frame.Targets.end(), [&](const Target& target)
+        {
+            return !target.InUse && !frame.Blocks[target.BlockIndex].InUse
+                && target.Format == format && target.Width == width && target.Height == height && target.Usage == usage;
+        });
+
+        Target& target = ((it != frame.Targets.end()) ? *it : CreateTarget(frame, format, width, height, usage));
+        target.InUse = true;
+        target.LastUsed = m_FrameCounter;
+
+        Block& block = frame.Blocks[target.BlockIndex];
+        target.RenderTarget->GetInternalImage().m_Aliased = block.Occupied;
+        block.InUse = true;
+        block.Occupied = true;
+
+        return target.RenderTarget.get();
+    }
+
+    void VulkanRenderTargetPool::Release(Image* renderTarget)
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        Frame& frame = m_Frames[VulkanRenderer::GetRenderer(m_RendererID).GetVulkanSwapChain().GetCurrentFrame()];
+
+        auto it = std::find_if(frame.Targets.begin(), frame.Targets.end(), [renderTarget](const Target& target) { return target.RenderTarget.get() == renderTarget; });
+        LU_ASSERT((it != frame.Targets.end() && it->InUse), "[VkRenderTargetPool] Released a render target that wasn't acquired this frame.");
+
+        // Note: From here on the block may be aliased by the next acquired target, which is marked
+        // as aliased so its first transition waits on the accesses of this one.
+        it->InUse = false;
+        frame.Blocks[it->BlockIndex].InUse = false;
+    }
+
+    void VulkanRenderTargetPool::Reset(uint32_t frameIndex)
+    {
+        LU_PROFILE("VkRenderTargetPool::Reset()");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        m_FrameCounter++;
+        Frame& frame = m_Frames[frameIndex];
+
+        for (auto& block : frame.Blocks)
+        {
+            block.InUse = false;
+            block.Occupied = false;
+        }
+
+        // Note: The frame's fences have been waited on, so its targets can be destroyed right away
+        for (auto& target : frame.Targets)
+        {
+            target.InUse = false;
+            if ((m_FrameCounter - target.LastUsed) >= MaxUnusedFrames)
+                DestroyTarget(target);
+        }
+        std::erase_if(frame.Targets, [](const Target& target) { return target.RenderTarget->GetInternalImage().GetVkImage() == VK_NULL_HANDLE; });
+
+        // Free the blocks that no target is bound to anymore (e.g. after a resize) & remap the indices
+        std::pmr::vector<size_t> remap(frame.Blocks.size(), std::numeric_limits<size_t>::max(), ScratchAllocator::Get());
+        for (const auto& target : frame.Targets)
+            remap[target.BlockIndex] = 0;
+
+        size_t kept = 0;
+        for (size_t i = 0; i < frame.Blocks.size(); i++)
+        {
+            if (remap[i] == std::numeric_limits<size_t>::max())
+            {
+                vmaFreeMemory(VulkanAllocator::s_Allocator, frame.Blocks[i].Allocation);
+                continue;
+            }
+
+            remap[i] = kept;
+            frame.Blocks[kept++] = frame.Blocks[i];
+        }
+        frame.Blocks.resize(kept);
+
+        for (auto& target : frame.Targets)
+            target.BlockIndex = remap[target.BlockIndex];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanRenderTargetPool::Target& VulkanRenderTargetPool::CreateTarget(Frame& frame, ImageFormat format, uint32_t width, uint32_t height, ImageUsage usage)
+    {
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = width;
+        imageInfo.extent.height = height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = ImageFormatToVkFormat(format);
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = ImageUsageToVkImageUsage(usage);
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VkImage image = VK_NULL_HANDLE;
+        VK_VERIFY(vkCreateImage(device, &imageInfo, nullptr, &image));
+
+        VkMemoryRequirements requirements = {};
+        vkGetImageMemoryRequirements(device, image, &requirements);
+
+        // Find a free block that's big enough, otherwise allocate a new one
+        auto blockIt = std::find_if(frame.Blocks.begin(), frame.Blocks.end(), [&](const Block& block)
+        {
+            return !block.InUse && block.Size >= requirements.size && (requirements.memoryTypeBits & (1u << block.MemoryType));
+        });
+
+        size_t blockIndex = static_cast<size_t>(std::distance(frame.Blocks.begin(), blockIt));
+        if (blockIt == frame.Blocks.end())
+        {
+            VmaAllocationCreateInfo allocCreateInfo = {};
+            allocCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+            allocCreateInfo.flags = VMA_ALLOCATION_CREATE_CAN_ALIAS_BIT;
+
+            Block& block = frame.Blocks.emplace_back();
+            VmaAllocationInfo allocInfo = {};
+            VK_VERIFY(vmaAllocateMemory(VulkanAllocator::s_Allocator, &requirements, &allocCreateInfo, &block.Allocation, &allocInfo));
+
+            block.Size = requirements.size;
+            block.MemoryType = allocInfo.memoryType;
+        }
+
+        VK_VERIFY(vmaBindImageMemory(VulkanAllocator::s_Allocator, frame.Blocks[blockIndex].Allocation, image));
+
+        Target& target = frame.Targets.emplace_back();
+        target.Format = format;
+        target.Width = width;
+        target.Height = height;
+        target.Usage = usage;
+        target.BlockIndex = blockIndex;
+        target.RenderTarget = std::make_unique<Image>();
+
+        const VkImageAspectFlags aspect = ((usage & ImageUsage::DepthStencil) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT);
+
+        // Note: The allocation stays null, since the memory belongs to the block
+        VulkanImage& vkImage = target.RenderTarget->GetInternalImage();
+        vkImage.m_ImageSpecification = { .Usage = usage, .Layout = ImageLayout::Undefined, .Format = format, .Width = width, .Height = height, .MipMaps = false };
+        vkImage.m_Image = image;
+        vkImage.m_ImageView = VulkanAllocator::CreateImageView(m_RendererID, image, imageInfo.format, aspect, 1);
+        if (usage & ImageUsage::Sampled)
+            vkImage.m_Sampler = VulkanAllocator::CreateSampler(m_RendererID, VK_FILTER_LINEAR, VK_FILTER_LINEAR, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE, VK_SAMPLER_MIPMAP_MODE_LINEAR, 1);
+
+        return target;
+    }
+
+    void VulkanRenderTargetPool::DestroyTarget(Target& target)
+    {
+        VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+        VulkanImage& vkImage = target.RenderTarget->GetInternalImage();
+
+        // Note: Evict before destroying, since the driver may hand out the same view handle again
+        VulkanRenderer::GetRenderer(m_RendererID).GetFramebufferCache().Evict(vkImage.m_ImageView);
+
+        if (vkImage.m_Sampler)
+            vkDestroySampler(device, vkImage.m_Sampler, nullptr);
+        vkDestroyImageView(device, vkImage.m_ImageView, nullptr);
+        vkDestroyImage(device, vkImage.m_Image, nullptr);
+
+        vkImage.m_Image = VK_NULL_HANDLE;
+        vkImage.m_ImageView = VK_NULL_HANDLE;
+        vkImage.m_Sampler = VK_NULL_HANDLE;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <memory>
+#include <vector>
+
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+#include "Lunar/Internal/Renderer/ImageSpec.hpp"
+
+#include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
+
+namespace Lunar::Internal
+{
+
+    class Image;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanRenderTargetPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Hands out render targets by (format, size, usage) for the duration of a frame.
+    // Every frame in flight has its own memory blocks (allocated with VMA_ALLOCATION_CREATE_CAN_ALIAS_BIT),
+    // a target that was released lends its block to the next target acquired in the same frame.
+    // So only targets that are alive at the same time take up separate memory.
+    // Note 2: The contents of a target are undefined when acquired, use ImageLayout::Undefined as the previous layout.
+    // Note 3: A target that takes over a block used earlier in the frame is marked as aliased, its first
+    // Renderer::Transition (from Undefined) then waits on all earlier commands instead of just the destination's stages.
+    class VulkanRenderTargetPool
+    {
+    public:
+        constexpr static const uint64_t MaxUnusedFrames = 16; // Note: Targets unused for this many frames get destroyed
+    public:
+        // Constructor & Destructor
+        VulkanRenderTargetPool();
+        ~VulkanRenderTargetPool();
+
+        // Init & Destroy
+        void Init(const RendererID rendererID, uint32_t frameCount);
+        void Destroy(); // Note: Only call when the device is idle
+
+        // Methods
+        Image* Acquire(ImageFormat format, uint32_t width, uint32_t height, ImageUsage usage); // Note: Valid until released or until the next BeginFrame
+        void Release(Image* target); // Note: Has to be called once the last command using the target has been recorded
+
+        void Reset(uint32_t frame); // Note: Only call once the frame's fences have been signaled
+
+    private:
+        struct Block
+        {
+        public:
+            VmaAllocation Allocation = VK_NULL_HANDLE;
+            VkDeviceSize Size = 0;
+            uint32_t MemoryType = 0;
+
+            bool InUse = false;
+            bool Occupied = false; // Note: Whether a target has been bound to it this frame
+        };
+
+        struct Target
+        {
+        public:
+            ImageFormat Format = ImageFormat::Undefined;
+            uint32_t Width = 0, Height = 0;
+            ImageUsage Usage = ImageUsage::None;
+
+            size_t BlockIndex = 0;
+            bool InUse = false;
+            uint64_t LastUsed = 0;
+
+            std::unique_ptr<Image> RenderTarget = nullptr; // Note: Heap allocated so the pointer stays valid when the vector grows
+        };
+
+        struct Frame
+        {
+        public:
+            std::vector<Block> Blocks = { };
+            std::vector<Target> Targets = { };
+        };
+
+    private:
+        // Private methods
+        Target& CreateTarget(Frame& frame, ImageFormat format, uint32_t width, uint32_t height, ImageUsage usage);
+        void DestroyTarget(Target& target);
+
+    private:
+        RendererID m_RendererID = 0;
+        uint64_t m_FrameCounter = 0;
+
+        std::mutex m_ThreadSafety = {};
+        std::vector<Frame> m_Frames = { };
+    };
+
+}
\ No newline at end of file
@@ -3,8 +3,11 @@
 
 #include "Lunar/Internal/IO/Print.hpp"
 #include "Lunar/Internal/Utils/Profiler.hpp"
+#include "Lunar/Internal/Utils/Timings.hpp"
 #include "Lunar/Internal/Utils/Settings.hpp"
 
+#include "Lunar/Internal/Memory/ScratchAllocator.hpp"
+
 #include "Lunar/Internal/Core/Window.hpp"
 
 #include "Lunar/Internal/Renderer/Image.hpp"
@@ -13,6 +16,7 @@
 
 #include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanImage.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanPipeline.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanRenderpass.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanCommandBuffer.hpp"
 
@@ -23,6 +27,37 @@
 namespace Lunar::Internal
 {
 
+    namespace
+    {
+        struct LayoutAccess
+        {
+        public:
+            VkPipelineStageFlags2 Stage = VK_PIPELINE_STAGE_2_NONE;
+            VkAccessFlags2 Access = VK_ACCESS_2_NONE;
+        };
+
+        // Note: The stages & accesses an image in this layout is (or will be) used with
+        static LayoutAccess GetLayoutAccess(VkImageLayout layout)
+        {
+            switch (layout)
+            {
+            case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:              return { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT };
+            case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:      return { VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT };
+            case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:       return { VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT };
+            case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:              return { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT };
+            case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:                  return { VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT };
+            case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:                  return { VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT };
+            // Note: Presentation waits on a semaphore, the acquire semaphore is waited on at colour attachment output
+            case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:                       return { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_NONE };
+
+            default:
+                break;
+            }
+
+            return { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT };
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
@@ -31,12 +66,26 @@ namespace Lunar::Internal
 		m_ID = id;
 		m_Specification = specs;
         m_TaskManager.Init(m_ID, static_cast<uint32_t>(specs.Buffers));
+        m_DeletionQueue.Init(m_ID, static_cast<uint32_t>(specs.Buffers));
+        m_FramebufferCache.Init(m_ID);
+        m_RenderTargetPool.Init(m_ID, static_cast<uint32_t>(specs.Buffers));
 
         m_SwapChain.Init(m_ID, specs.WindowRef);
+
+        QueueFamilyIndices queueFamilyIndices = QueueFamilyIndices::Find(m_SwapChain.GetVkSurface(), VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice());
+        m_CommandPools.Init(m_ID, queueFamilyIndices.GraphicsFamily.value(), static_cast<uint32_t>(specs.Buffers));
+        VulkanCommandPools::SetSlot(0);
+        m_TransientCommandPool.Init(queueFamilyIndices.GraphicsFamily.value(), 4);
+        m_GPUProfiler.Init(m_ID, queueFamilyIndices.GraphicsFamily.value(), static_cast<uint32_t>(specs.Buffers));
+
+        m_ImageStreamer.Init(m_ID);
     }
 
     void VulkanRenderer::Destroy()
     {
+        m_ImageStreamer.Destroy();
+        m_RecordWorkers.Destroy();
+
 		// Wait for the device to finish
         {
             VulkanContext::GetVulkanDevice().Wait();
@@ -45,10 +94,21 @@ namespace Lunar::Internal
 		    vkQueueWaitIdle(VulkanContext::GetVulkanDevice().GetQueue(Queue::Present));
         }
 
-        FreeQueue();
+        {
+            std::scoped_lock<std::mutex> lock(m_SubmitMutex);
+            m_Submissions.clear();
+            m_WaitInfos.clear();
+        }
+
+        m_GPUProfiler.Destroy();
+        m_RenderTargetPool.Destroy();
+        m_FramebufferCache.Destroy();
+        m_DeletionQueue.DrainAll();
+        m_CommandPools.Destroy();
         m_SwapChain.Destroy();
+        m_TransientCommandPool.Destroy();
 		m_TaskManager.Destroy();
-        FreeQueue();
+        m_DeletionQueue.Destroy();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -57,13 +117,14 @@ namespace Lunar::Internal
     void VulkanRenderer::BeginFrame()
     {
         LU_PROFILE("VkRenderer::BeginFrame()");
-        if (m_Specification.WindowRef->IsMinimized())
-            return;
+        LU_TIME("VkRenderer::BeginFrame");
 
-        // Free objects
-        FreeQueue();
+        // Note: Everything from here on counts towards the new frame
+        m_FrameStats.Swap();
+        VulkanCommandPools::SetSlot(0);
 
         // Handle synchronization
+        // Note: This also happens when minimized, since command buffers can still be recorded & submitted
         {
             auto& fences = m_TaskManager.GetFences();
             if (!fences.empty()) 
@@ -76,9 +137,24 @@ namespace Lunar::Internal
             }
             m_TaskManager.ResetFences();
 
-            m_TaskManager.Add(m_SwapChain.GetCurrentImageAvailableSemaphore());
+            // All command buffers of this frame have finished executing, so its command buffers & freed objects can be released
+            m_CommandPools.Reset(m_SwapChain.GetCurrentFrame());
+            m_DeletionQueue.BeginFrame();
+            m_FramebufferCache.Update();
+            m_RenderTargetPool.Reset(m_SwapChain.GetCurrentFrame());
+            m_GPUProfiler.BeginFrame(m_SwapChain.GetCurrentFrame());
         }
 
+        // Upload all images that finished decoding since the last frame in one batch
+        m_ImageStreamer.Update();
+
+        if (m_Specification.WindowRef->IsMinimized())
+            return;
+
+        // Note: Headless images are owned by the frame, so there's nothing to wait on
+        if (!m_SwapChain.IsHeadless())
+            m_TaskManager.Add(m_SwapChain.GetCurrentImageAvailableSemaphore());
+
         // Start frame
         m_SwapChain.AcquireNextImage();
     }
@@ -86,24 +162,39 @@ namespace Lunar::Internal
     void VulkanRenderer::EndFrame()
     {
         LU_PROFILE("VkRenderer::EndFrame()");
-        if (m_Specification.WindowRef->IsMinimized())
-            return;
+
+        // Note: Recorded submissions are always flushed, since Submit() also doesn't check for minimization
+        if (m_Specification.DeferredSubmission)
+            FlushSubmissions();
+
+        m_GPUProfiler.EndFrame();
     }
 
     void VulkanRenderer::Present()
     {
         LU_PROFILE("VkRenderer::Present()");
+        LU_TIME("VkRenderer::Present");
         if (m_Specification.WindowRef->IsMinimized())
             return;
 
+        if (m_SwapChain.IsHeadless())
+        {
+            m_SwapChain.PresentHeadless(m_TaskManager.GetSemaphores());
+            m_FrameStats.Add(FrameStat::Submits);
+
+            m_TaskManager.ResetSemaphores();
+            m_SwapChain.m_CurrentFrame = (m_SwapChain.m_CurrentFrame + 1) % static_cast<uint32_t>(m_Specification.Buffers);
+            return;
+        }
+
         #if !defined(LU_CONFIG_DIST)
-        std::vector<VkSemaphore> semaphores = m_TaskManager.GetSemaphores();
+        std::pmr::vector<VkSemaphore> semaphores(m_TaskManager.GetSemaphores().begin(), m_TaskManager.GetSemaphores().end(), ScratchAllocator::Get());
         
         auto pos = std::find(semaphores.begin(), semaphores.end(), m_SwapChain.GetCurrentImageAvailableSemaphore());
         
         if (pos != semaphores.end())
 		{
-			LU_LOG_ERROR("[VkRenderer] PresentQueue is waiting on acquire image semaphore. This is undefined behaviour. To solve this start some form of renderpass. (Or just render soemthing).");
+			LU_LOG_LIMITED(Error, Vulkan, "[VkRenderer] PresentQueue is waiting on acquire image semaphore. This is undefined behaviour. To solve this start some form of renderpass. (Or just render soemthing).");
 
             uint64_t waitValue = 0;
 			VkSemaphore waitSemaphore = m_SwapChain.GetCurrentImageAvailableSemaphore();
@@ -142,7 +233,7 @@ namespace Lunar::Internal
         }
         else if (result != VK_SUCCESS) 
         {
-            LU_LOG_ERROR("[VulkanRenderer] Failed to present swap chain image!");
+            LU_LOG_LIMITED(Error, Vulkan, "[VulkanRenderer] Failed to present swap chain image!");
         }
 
         m_TaskManager.ResetSemaphores();
@@ -154,27 +245,32 @@ namespace Lunar::Internal
         LU_PROFILE("VkRenderer::BeginDynamic()");
         VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
 
-        VkRenderingAttachmentInfo colourAttachment = {};
-        colourAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
-        colourAttachment.imageView = (state.ColourAttachment ? state.ColourAttachment->GetInternalImage().GetVkImageView() : VK_NULL_HANDLE);
-        colourAttachment.imageLayout = (state.ColourAttachment ? ImageLayoutToVkImageLayout(state.ColourAttachment->GetSpecification().Layout) : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-        colourAttachment.loadOp = LoadOperationToVkAttachmentLoadOp(state.ColourLoadOp);
-        colourAttachment.storeOp = StoreOperationToVkAttachmentStoreOp(state.ColourStoreOp);
-        colourAttachment.clearValue.color = { { state.ColourClearValue.r, state.ColourClearValue.g, state.ColourClearValue.b, state.ColourClearValue.a } };
+        std::pmr::vector<VkRenderingAttachmentInfo> colourAttachments(ScratchAllocator::Get());
+        colourAttachments.reserve(state.ColourAttachments.size());
+        for (Image* image : state.ColourAttachments)
+        {
+            VkRenderingAttachmentInfo& colourAttachment = colourAttachments.emplace_back();
+            colourAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+            colourAttachment.imageView = image->GetInternalImage().GetVkImageView();
+            colourAttachment.imageLayout = ImageLayoutToVkImageLayout(state.ColourLayout);
+            colourAttachment.loadOp = LoadOperationToVkAttachmentLoadOp(state.ColourLoadOp);
+            colourAttachment.storeOp = StoreOperationToVkAttachmentStoreOp(state.ColourStoreOp);
+            colourAttachment.clearValue.color = { { state.ColourClearValue.r, state.ColourClearValue.g, state.ColourClearValue.b, state.ColourClearValue.a } };
+        }
 
         VkRenderingAttachmentInfo depthAttachment = {};
         depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
         depthAttachment.imageView = (state.DepthAttachment ? state.DepthAttachment->GetInternalImage().GetVkImageView() : VK_NULL_HANDLE);
-        depthAttachment.imageLayout = (state.DepthAttachment ? ImageLayoutToVkImageLayout(state.DepthAttachment->GetSpecification().Layout) : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        depthAttachment.imageLayout = ImageLayoutToVkImageLayout(state.DepthLayout);
         depthAttachment.loadOp = LoadOperationToVkAttachmentLoadOp(state.DepthLoadOp);
         depthAttachment.storeOp = StoreOperationToVkAttachmentStoreOp(state.DepthStoreOp);
         depthAttachment.clearValue.depthStencil = { state.DepthClearValue, 0 };
 
         uint32_t width = 0, height = 0;
-        if (state.ColourAttachment)
+        if (!state.ColourAttachments.empty())
         {
-            width = state.ColourAttachment->GetSpecification().Width;
-            height = state.ColourAttachment->GetSpecification().Height;
+            width = state.ColourAttachments[0]->GetSpecification().Width;
+            height = state.ColourAttachments[0]->GetSpecification().Height;
         }
         else if (state.DepthAttachment)
         {
@@ -191,8 +287,8 @@ namespace Lunar::Internal
         renderingInfo.renderArea.offset = { 0, 0 };
         renderingInfo.renderArea.extent = { width, height };
         renderingInfo.layerCount = 1;
-        renderingInfo.colorAttachmentCount = (state.ColourAttachment ? 1 : 0);
-        renderingInfo.pColorAttachments = (state.ColourAttachment ? &colourAttachment : nullptr);
+        renderingInfo.colorAttachmentCount = static_cast<uint32_t>(colourAttachments.size());
+        renderingInfo.pColorAttachments = colourAttachments.data();
         renderingInfo.pDepthAttachment = (state.DepthAttachment ? &depthAttachment : nullptr);
 
         vkCmdBeginRendering(vkCmdBuf.GetVkCommandBuffer(m_SwapChain.GetCurrentFrame()), &renderingInfo);
@@ -226,6 +322,90 @@ namespace Lunar::Internal
         vkCmdSetScissor(vkCmdBuf.m_CommandBuffers[m_SwapChain.GetCurrentFrame()], 0, 1, &scissor);
     }
 
+    void VulkanRenderer::Transition(CommandBuffer& cmdBuf, std::span<const ImageTransition> transitions)
+    {
+        LU_PROFILE("VkRenderer::Transition()");
+        if (transitions.empty())
+            return;
+
+        VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
+
+        std::pmr::vector<VkImageMemoryBarrier2> barriers(ScratchAllocator::Get());
+        barriers.reserve(transitions.size());
+
+        for (const auto& transition : transitions)
+        {
+            VulkanImage& vkImage = transition.Target->GetInternalImage();
+            const VkImageLayout initial = ImageLayoutToVkImageLayout(transition.Initial);
+            const VkImageLayout final = ImageLayoutToVkImageLayout(transition.Final);
+
+            const LayoutAccess dst = GetLayoutAccess(final);
+
+            // Note: Undefined only discards the contents, the image can still be in use. E.g. the swapchain image
+            // by the presentation engine (the acquire semaphore is waited on at colour attachment output) or a shared
+            // depth image by the previous pass. So the layout change waits on earlier work in the destination's stages.
+            // An aliased render target shares its memory with a target that may have been used in any stage, so it waits on everything.
+            LayoutAccess src = ((initial == VK_IMAGE_LAYOUT_UNDEFINED) ? dst : GetLayoutAccess(initial));
+            if (initial == VK_IMAGE_LAYOUT_UNDEFINED && vkImage.IsAliased())
+                src = { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_WRITE_BIT };
+
+            VkImageMemoryBarrier2& barrier = barriers.emplace_back();
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+            barrier.srcStageMask = src.Stage;
+            barrier.srcAccessMask = (src.Access & (VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT)); // Note: Only writes have to be made available
+            barrier.dstStageMask = dst.Stage;
+            barrier.dstAccessMask = dst.Access;
+            barrier.oldLayout = initial;
+            barrier.newLayout = final;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = vkImage.GetVkImage();
+
+            const VkFormat format = ImageFormatToVkFormat(vkImage.GetSpecification().Format);
+            if (vkImage.GetSpecification().Usage & ImageUsage::DepthStencil)
+            {
+                barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+                if (format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT)
+                    barrier.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+            }
+            else
+            {
+                barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            }
+
+            barrier.subresourceRange.baseMipLevel = 0;
+            barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        }
+
+        VkDependencyInfo dependencyInfo = {};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(barriers.size());
+        dependencyInfo.pImageMemoryBarriers = barriers.data();
+
+        vkCmdPipelineBarrier2(vkCmdBuf.GetVkCommandBuffer(m_SwapChain.GetCurrentFrame()), &dependencyInfo);
+        m_FrameStats.Add(FrameStat::Barriers);
+    }
+
+    void VulkanRenderer::ClearDepth(CommandBuffer& cmdBuf, uint32_t width, uint32_t height, float depth)
+    {
+        LU_PROFILE("VkRenderer::ClearDepth()");
+        VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
+
+        VkClearAttachment attachment = {};
+        attachment.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        attachment.clearValue.depthStencil = { depth, 0 };
+
+        VkClearRect rect = {};
+        rect.rect.offset = { 0, 0 };
+        rect.rect.extent = { width, height };
+        rect.baseArrayLayer = 0;
+        rect.layerCount = 1;
+
+        vkCmdClearAttachments(vkCmdBuf.GetVkCommandBuffer(m_SwapChain.GetCurrentFrame()), 1, &attachment, 1, &rect);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Object methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -235,16 +415,15 @@ namespace Lunar::Internal
         VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
 
         uint32_t currentFrame = m_SwapChain.GetCurrentFrame();
-        VkCommandBuffer commandBuffer = vkCmdBuf.m_CommandBuffers[currentFrame];
 
         {
             LU_PROFILE("VkRenderer::Begin::ResetFences");
             vkResetFences(VulkanContext::GetVulkanDevice().GetVkDevice(), 1, &vkCmdBuf.m_InFlightFences[currentFrame]);
         }
-        {
-            LU_PROFILE("VkRenderer::Begin::ResetCmdBuf");
-            vkResetCommandBuffer(commandBuffer, 0);
-        }
+
+        // Note: The command buffer comes from the calling thread's pool, which gets reset as a whole in BeginFrame
+        VkCommandBuffer commandBuffer = m_CommandPools.Acquire(currentFrame);
+        vkCmdBuf.m_CommandBuffers[currentFrame] = commandBuffer;
 
         VkCommandBufferBeginInfo beginInfo = {};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -255,7 +434,7 @@ namespace Lunar::Internal
         }
     }
 
-    void VulkanRenderer::Begin(Renderpass& renderpass)
+    void VulkanRenderer::Begin(Renderpass& renderpass, SubpassContents contents)
     {
         LU_PROFILE("VkRenderer::Begin(Renderpass)");
         CommandBuffer& cmdBuf = renderpass.GetCommandBuffer();
@@ -270,31 +449,68 @@ namespace Lunar::Internal
         VkRenderPassBeginInfo renderPassInfo = {};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
         renderPassInfo.renderPass = vkRenderpass.m_RenderPass;
-        renderPassInfo.framebuffer = vkRenderpass.m_Framebuffers[m_SwapChain.GetAquiredImage()];
+        renderPassInfo.framebuffer = vkRenderpass.GetVkFramebuffer(m_ID, m_SwapChain.GetAquiredImage());
         renderPassInfo.renderArea.offset = { 0, 0 };
         renderPassInfo.renderArea.extent = extent;
 
-        std::vector<VkClearValue> clearValues = {};
+        // Note: At most a colour & a depth clear value
+        std::array<VkClearValue, 2> clearValues = {};
+        uint32_t clearValueCount = 0;
         if (!vkRenderpass.m_Specification.ColourAttachment.empty())
         {
             VkClearValue colourClear = { { { vkRenderpass.m_Specification.ColourClearColour.r, vkRenderpass.m_Specification.ColourClearColour.g, vkRenderpass.m_Specification.ColourClearColour.b, vkRenderpass.m_Specification.ColourClearColour.a } } };
-            clearValues.push_back(colourClear);
+            clearValues[clearValueCount++] = colourClear;
         }
         if (vkRenderpass.m_Specification.DepthAttachment)
         {
             VkClearValue depthClear = { { { 1.0f, 0 } } };
-            clearValues.push_back(depthClear);
+            clearValues[clearValueCount++] = depthClear;
         }
 
-        renderPassInfo.clearValueCount = (uint32_t)clearValues.size();
+        renderPassInfo.clearValueCount = clearValueCount;
         renderPassInfo.pClearValues = clearValues.data();
 
         {
             LU_PROFILE("VkRenderer::Begin::BeginPass");
-            vkCmdBeginRenderPass(vkCmdBuf.m_CommandBuffers[m_SwapChain.GetCurrentFrame()], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBeginRenderPass(vkCmdBuf.m_CommandBuffers[m_SwapChain.GetCurrentFrame()], &renderPassInfo, SubpassContentsToVkSubpassContents(contents));
+        }
+
+        // Note: With secondary command buffers only vkCmdExecuteCommands is allowed, they set their own viewport & scissor
+        if (contents == SubpassContents::Inline)
+            SetViewportAndScissor(cmdBuf, extent.width, extent.height);
+    }
+
+    void VulkanRenderer::Begin(CommandBuffer& secondary, Renderpass& renderpass)
+    {
+        LU_PROFILE("VkRenderer::Begin(Secondary, Renderpass)");
+        VulkanCommandBuffer& vkCmdBuf = secondary.GetInternalCommandBuffer();
+        VulkanRenderpass& vkRenderpass = renderpass.GetInternalRenderpass();
+
+        LU_ASSERT((vkCmdBuf.m_Level == CommandBufferLevel::Secondary), "[VulkanRenderer] Begin(Secondary, Renderpass) requires a CommandBuffer created with CommandBufferLevel::Secondary.");
+
+        uint32_t currentFrame = m_SwapChain.GetCurrentFrame();
+
+        VkCommandBuffer commandBuffer = m_CommandPools.Acquire(currentFrame, CommandBufferLevel::Secondary);
+        vkCmdBuf.m_CommandBuffers[currentFrame] = commandBuffer;
+
+        VkCommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = vkRenderpass.m_RenderPass;
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = vkRenderpass.GetVkFramebuffer(m_ID, m_SwapChain.GetAquiredImage());
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        {
+            LU_PROFILE("VkRenderer::Begin::BeginCmdBuf");
+            VK_VERIFY(vkBeginCommandBuffer(commandBuffer, &beginInfo));
         }
 
-        SetViewportAndScissor(cmdBuf, extent.width, extent.height);
+        auto size = renderpass.GetSize();
+        SetViewportAndScissor(secondary, size.x, size.y);
     }
 
     void VulkanRenderer::End(CommandBuffer& cmdBuf)
@@ -324,15 +540,23 @@ namespace Lunar::Internal
     void VulkanRenderer::Submit(CommandBuffer& cmdBuf, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn)
     {
         LU_PROFILE("VkRenderer::Submit(CommandBuffer)");
+        LU_TIME("VkRenderer::Submit");
         VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
 
+        if (m_Specification.DeferredSubmission)
+        {
+            SubmitDeferred(vkCmdBuf, policy, queue, waitStage, waitOn);
+            return;
+        }
+
         uint32_t currentFrame = m_SwapChain.GetCurrentFrame();
         VkCommandBuffer commandBuffer = vkCmdBuf.m_CommandBuffers[currentFrame];
 
         VkSubmitInfo submitInfo = {};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-        std::vector<VkSemaphore> semaphores = { };
+        std::pmr::vector<VkSemaphore> semaphores(ScratchAllocator::Get());
+        semaphores.reserve(waitOn.size() + 1);
         for (auto& cmd : waitOn)
         {
             VulkanCommandBuffer& vkCmd = cmd->GetInternalCommandBuffer();
@@ -349,13 +573,13 @@ namespace Lunar::Internal
             // Check if it's not nullptr
             if (semaphore)
             {
-                #if !defined(LU_CONFIG_DIST) // Check if semaphore not already exists
 				bool exists = false;
+                #if !defined(LU_CONFIG_DIST) // Check if semaphore not already exists
                 for (const auto& sem : semaphores)
                 {
 					if (sem == semaphore) [[unlikely]]
 					{
-						LU_LOG_WARN("[VulkanRenderer] Semaphore already exists in the waitOn list!");
+						LU_LOG_LIMITED(Warn, Vulkan, "[VulkanRenderer] Semaphore already exists in the waitOn list!");
 						exists = true;
 						break;
 					}
@@ -367,7 +591,7 @@ namespace Lunar::Internal
             }
         }
 
-        std::vector<VkPipelineStageFlags> waitStages(semaphores.size(), (VkPipelineStageFlagBits)waitStage);
+        std::pmr::vector<VkPipelineStageFlags> waitStages(semaphores.size(), (VkPipelineStageFlagBits)waitStage, ScratchAllocator::Get());
 
         submitInfo.waitSemaphoreCount = static_cast<uint32_t>(semaphores.size());
         submitInfo.pWaitSemaphores = semaphores.data();
@@ -383,6 +607,7 @@ namespace Lunar::Internal
             LU_PROFILE("VkRenderer::Submit::QueueSubmit");
             VK_VERIFY(vkQueueSubmit(VulkanContext::GetVulkanDevice().GetQueue(queue), 1, &submitInfo, vkCmdBuf.m_InFlightFences[currentFrame]));
         }
+        m_FrameStats.Add(FrameStat::Submits);
         m_TaskManager.Add(vkCmdBuf, policy);
     }
 
@@ -392,20 +617,91 @@ namespace Lunar::Internal
         Submit(renderpass.GetCommandBuffer(), policy, queue, waitStage, waitOn);
     }
 
+    void VulkanRenderer::Execute(Renderpass& renderpass, const std::vector<CommandBuffer*>& secondaries)
+    {
+        LU_PROFILE("VkRenderer::Execute()");
+        VulkanCommandBuffer& vkCmdBuf = renderpass.GetCommandBuffer().GetInternalCommandBuffer();
+
+        uint32_t currentFrame = m_SwapChain.GetCurrentFrame();
+
+        std::pmr::vector<VkCommandBuffer> commandBuffers(ScratchAllocator::Get());
+        commandBuffers.reserve(secondaries.size());
+
+        for (auto& secondary : secondaries)
+        {
+            VulkanCommandBuffer& vkSecondary = secondary->GetInternalCommandBuffer();
+            LU_ASSERT((vkSecondary.m_Level == CommandBufferLevel::Secondary), "[VulkanRenderer] Only secondary CommandBuffers can be executed.");
+
+            commandBuffers.push_back(vkSecondary.m_CommandBuffers[currentFrame]);
+        }
+
+        if (!commandBuffers.empty())
+            vkCmdExecuteCommands(vkCmdBuf.m_CommandBuffers[currentFrame], static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
+    }
+
+    void VulkanRenderer::Record(const std::vector<RecordFn>& tasks)
+    {
+        LU_PROFILE("VkRenderer::Record()");
+        if (tasks.empty())
+            return;
+
+        LU_ASSERT((VulkanCommandPools::GetSlot() == 0), "[VulkanRenderer] Record() has to be called from the thread calling Renderer::BeginFrame.");
+
+        // Note: The workers are persistent & each one records into its own fixed slot (and with that its own command pools)
+        if (m_RecordWorkers.GetThreadCount() == 0) [[unlikely]]
+            m_RecordWorkers.Init(std::max(std::thread::hardware_concurrency(), 2u) - 1u, [](uint32_t index) { VulkanCommandPools::SetSlot(index + 1); });
+        m_CommandPools.Reserve(m_RecordWorkers.GetThreadCount() + 1);
+
+        // Note: The last worker notifies while holding the lock, so the batch can't go out of scope underneath it
+        struct Batch
+        {
+        public:
+            const std::vector<RecordFn>* Tasks = nullptr;
+            uint32_t Remaining = 0;
+
+            std::mutex Mutex = {};
+            std::condition_variable Done = {};
+        };
+
+        Batch batch = { .Tasks = &tasks, .Remaining = static_cast<uint32_t>(tasks.size() - 1) };
+
+        // Note: Only captures two pointers' worth, so the std::function doesn't allocate
+        for (uint32_t i = 1; i < static_cast<uint32_t>(tasks.size()); i++)
+        {
+            m_RecordWorkers.Push([&batch, i]()
+            {
+                (*batch.Tasks)[i]();
+
+                std::scoped_lock<std::mutex> lock(batch.Mutex);
+                if (--batch.Remaining == 0)
+                    batch.Done.notify_one();
+            });
+        }
+
+        // The calling thread records the first task using its own slot
+        tasks[0]();
+
+        std::unique_lock<std::mutex> lock(batch.Mutex);
+        batch.Done.wait(lock, [&batch]() { return batch.Remaining == 0; });
+    }
+
     void VulkanRenderer::Draw(CommandBuffer& cmdBuf, uint32_t vertexCount, uint32_t instanceCount)
     {
         LU_PROFILE("VkRenderer::Draw()");
         VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
 
         vkCmdDraw(vkCmdBuf.GetVkCommandBuffer(m_SwapChain.GetCurrentFrame()), vertexCount, instanceCount, 0, 0);
+        m_FrameStats.Add(FrameStat::DrawCalls);
     }
 
-    void VulkanRenderer::DrawIndexed(CommandBuffer& cmdBuf, uint32_t indexCount, uint32_t instanceCount)
+    void VulkanRenderer::DrawIndexed(CommandBuffer& cmdBuf, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex)
     {
         LU_PROFILE("VkRenderer::DrawIndexed()");
         VulkanCommandBuffer& vkCmdBuf = cmdBuf.GetInternalCommandBuffer();
 
-        vkCmdDrawIndexed(vkCmdBuf.GetVkCommandBuffer(m_SwapChain.GetCurrentFrame()), indexCount, instanceCount, 0, 0, 0);
+        vkCmdDrawIndexed(vkCmdBuf.GetVkCommandBuffer(m_SwapChain.GetCurrentFrame()), indexCount, instanceCount, firstIndex, 0, 0);
+        m_FrameStats.Add(FrameStat::DrawCalls);
+        m_FrameStats.Add(FrameStat::Indices, static_cast<uint64_t>(indexCount) * instanceCount);
     }
 
     void VulkanRenderer::DrawIndexed(CommandBuffer& cmdBuf, IndexBuffer& indexBuffer, uint32_t instanceCount)
@@ -416,21 +712,23 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Internal methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanRenderer::Free(const FreeFn& fn)
+    void VulkanRenderer::Readback(std::vector<uint8_t>& pixels)
     {
-        std::scoped_lock<std::mutex> lock(m_FreeMutex);
-        m_FreeQueue.push(fn);
+        LU_PROFILE("VkRenderer::Readback()");
+        LU_ASSERT(m_SwapChain.IsHeadless(), "[VkRenderer] Only headless renderers can read back their frames, presented images belong to the presentation engine.");
+
+        // Note: Present doesn't advance the acquired image, so this is the last presented frame
+        m_SwapChain.m_Images[m_SwapChain.GetAquiredImage()].GetData(m_ID, pixels, ImageLayout::PresentSrcKHR);
     }
 
-    void VulkanRenderer::FreeQueue()
+    uint32_t VulkanRenderer::BeginGPUZone(CommandBuffer& cmdBuf, const char* name)
     {
-        LU_PROFILE("VkRenderer::FreeQueue");
-        std::scoped_lock<std::mutex> lock(m_FreeMutex);
-        while (!m_FreeQueue.empty())
-        {
-            m_FreeQueue.front()();
-            m_FreeQueue.pop();
-        }
+        return m_GPUProfiler.BeginZone(cmdBuf.GetInternalCommandBuffer(), name);
+    }
+
+    void VulkanRenderer::EndGPUZone(CommandBuffer& cmdBuf, uint32_t zone)
+    {
+        m_GPUProfiler.EndZone(cmdBuf.GetInternalCommandBuffer(), zone);
     }
 
     void VulkanRenderer::Recreate(uint32_t width, uint32_t height, bool vsync)
@@ -451,6 +749,12 @@ namespace Lunar::Internal
         return VkFormatToImageFormat(VulkanContext::GetVulkanPhysicalDevice().FindDepthFormat());
     }
 
+    ImageFormat VulkanRenderer::GetCompressedFormat() const
+    {
+        VkFormat format = VulkanContext::GetVulkanPhysicalDevice().GetCompressedFormat();
+        return (format == VK_FORMAT_UNDEFINED ? ImageFormat::RGBA : VkFormatToImageFormat(format));
+    }
+
     std::vector<Image*> VulkanRenderer::GetSwapChainImages()
     {
         std::vector<Image*> images(m_SwapChain.m_Images.size());
@@ -470,4 +774,115 @@ namespace Lunar::Internal
             return Renderer::GetRenderer(id).GetInternalRenderer();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanRenderer::SubmitDeferred(VulkanCommandBuffer& vkCmdBuf, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn)
+    {
+        LU_PROFILE("VkRenderer::SubmitDeferred()");
+        std::scoped_lock<std::mutex> lock(m_SubmitMutex);
+
+        uint32_t currentFrame = m_SwapChain.GetCurrentFrame();
+        VkPipelineStageFlags2 stageMask = static_cast<VkPipelineStageFlags2>(PipelineStageToVkPipelineStage(waitStage));
+
+        DeferredSubmission& submission = m_Submissions.emplace_back();
+        submission.SubmitQueue = queue;
+        submission.Fence = vkCmdBuf.m_InFlightFences[currentFrame];
+        submission.WaitOffset = static_cast<uint32_t>(m_WaitInfos.size());
+
+        auto addWait = [&](VkSemaphore semaphore)
+        {
+            VkSemaphoreSubmitInfo& waitInfo = m_WaitInfos.emplace_back();
+            waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            waitInfo.semaphore = semaphore;
+            waitInfo.stageMask = stageMask;
+        };
+
+        for (auto& cmd : waitOn)
+        {
+            VulkanCommandBuffer& vkCmd = cmd->GetInternalCommandBuffer();
+            auto semaphore = vkCmd.m_RenderFinishedSemaphores[currentFrame];
+
+            addWait(semaphore);
+            m_TaskManager.Remove(semaphore); // Removes it if it exists
+        }
+
+        if (!(policy & ExecutionPolicy::NoWaiting))
+        {
+            auto semaphore = m_TaskManager.GetNext();
+
+            // Check if it's not nullptr
+            if (semaphore)
+            {
+                bool exists = std::any_of(m_WaitInfos.begin() + submission.WaitOffset, m_WaitInfos.end(), [semaphore](const VkSemaphoreSubmitInfo& info) { return info.semaphore == semaphore; });
+                
+                #if !defined(LU_CONFIG_DIST)
+                if (exists) [[unlikely]]
+                    LU_LOG_LIMITED(Warn, Vulkan, "[VulkanRenderer] Semaphore already exists in the waitOn list!");
+                #endif
+
+                if (!exists) [[likely]]
+                    addWait(semaphore);
+            }
+        }
+
+        submission.WaitCount = static_cast<uint32_t>(m_WaitInfos.size()) - submission.WaitOffset;
+
+        submission.CommandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+        submission.CommandBufferInfo.commandBuffer = vkCmdBuf.m_CommandBuffers[currentFrame];
+
+        submission.SignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        submission.SignalInfo.semaphore = vkCmdBuf.m_RenderFinishedSemaphores[currentFrame];
+        submission.SignalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+        // Note: The fence gets added when the batch is flushed, since only the last fence of a batch gets signaled
+        m_TaskManager.Add(vkCmdBuf, policy, false);
+    }
+
+    void VulkanRenderer::FlushSubmissions()
+    {
+        LU_PROFILE("VkRenderer::FlushSubmissions()");
+        LU_TIME("VkRenderer::FlushSubmissions");
+        std::scoped_lock<std::mutex> lock(m_SubmitMutex);
+
+        // Note: Consecutive submissions to the same queue get merged into a single vkQueueSubmit2 call.
+        // A different queue starts a new call, so that semaphores are always signaled in an earlier call than they are waited on.
+        size_t begin = 0;
+        while (begin < m_Submissions.size())
+        {
+            const Queue queue = m_Submissions[begin].SubmitQueue;
+
+            m_SubmitInfos.clear();
+
+            size_t end = begin;
+            for (; end < m_Submissions.size() && m_Submissions[end].SubmitQueue == queue; end++)
+            {
+                const DeferredSubmission& submission = m_Submissions[end];
+
+                VkSubmitInfo2& submitInfo = m_SubmitInfos.emplace_back();
+                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+                submitInfo.waitSemaphoreInfoCount = submission.WaitCount;
+                submitInfo.pWaitSemaphoreInfos = (submission.WaitCount ? &m_WaitInfos[submission.WaitOffset] : nullptr);
+                submitInfo.commandBufferInfoCount = 1;
+                submitInfo.pCommandBufferInfos = &submission.CommandBufferInfo;
+                submitInfo.signalSemaphoreInfoCount = 1;
+                submitInfo.pSignalSemaphoreInfos = &submission.SignalInfo;
+            }
+
+            // Note: The fence is signaled once all batches in the call have completed
+            VkFence fence = m_Submissions[end - 1].Fence;
+            {
+                LU_PROFILE("VkRenderer::FlushSubmissions::QueueSubmit2");
+                VK_VERIFY(vkQueueSubmit2(VulkanContext::GetVulkanDevice().GetQueue(queue), static_cast<uint32_t>(m_SubmitInfos.size()), m_SubmitInfos.data(), fence));
+            }
+            m_FrameStats.Add(FrameStat::Submits);
+            m_TaskManager.Add(fence);
+
+            begin = end;
+        }
+
+        m_Submissions.clear();
+        m_WaitInfos.clear();
+    }
+
 }
\ No newline at end of file
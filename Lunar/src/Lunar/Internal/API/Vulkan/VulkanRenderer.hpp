@@ -1,7 +1,6 @@
 #pragma once
 
 #include <cstdint>
-#include <queue>
 #include <mutex>
 
 #include "Lunar/Internal/Renderer/RendererSpec.hpp"
@@ -10,10 +9,19 @@
 #include "Lunar/Internal/Renderer/Renderpass.hpp"
 #include "Lunar/Internal/Renderer/CommandBuffer.hpp"
 
+#include "Lunar/Internal/Utils/ThreadPool.hpp"
+
 #include "Lunar/Internal/API/Vulkan/Vulkan.hpp"
 
 #include "Lunar/Internal/API/Vulkan/VulkanSwapChain.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanTaskManager.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanCommandPools.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanDeletionQueue.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanImageStreamer.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanFramebufferCache.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanRenderTargetPool.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanGPUProfiler.hpp"
+#include "Lunar/Internal/API/Vulkan/VulkanFrameStats.hpp"
 
 namespace Lunar::Internal
 {
@@ -41,22 +49,44 @@ namespace Lunar::Internal
         void EndDynamic(CommandBuffer& cmdBuf);
 
         void SetViewportAndScissor(CommandBuffer& cmdBuf, uint32_t width, uint32_t height);
+        void Transition(CommandBuffer& cmdBuf, std::span<const ImageTransition> transitions);
+        void ClearDepth(CommandBuffer& cmdBuf, uint32_t width, uint32_t height, float depth);
 
         // Object methods
         void Begin(CommandBuffer& cmdBuf);
-        void Begin(Renderpass& renderpass);
+        void Begin(Renderpass& renderpass, SubpassContents contents);
+        void Begin(CommandBuffer& secondary, Renderpass& renderpass);
         void End(CommandBuffer& cmdBuf);
         void End(Renderpass& renderpass);
         void Submit(CommandBuffer& cmdBuf, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn);
         void Submit(Renderpass& renderpass, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn);
 
+        void Execute(Renderpass& renderpass, const std::vector<CommandBuffer*>& secondaries);
+        void Record(const std::vector<RecordFn>& tasks);
+
         void Draw(CommandBuffer& cmdBuf, uint32_t vertexCount, uint32_t instanceCount);
-        void DrawIndexed(CommandBuffer& cmdBuf, uint32_t indexCount, uint32_t instanceCount);
+        void DrawIndexed(CommandBuffer& cmdBuf, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex = 0);
         void DrawIndexed(CommandBuffer& cmdBuf, IndexBuffer& indexBuffer, uint32_t instanceCount);
 
+        inline Image* AcquireRenderTarget(ImageFormat format, uint32_t width, uint32_t height, ImageUsage usage) { return m_RenderTargetPool.Acquire(format, width, height, usage); }
+        inline void ReleaseRenderTarget(Image* renderTarget) { m_RenderTargetPool.Release(renderTarget); }
+
+        void Readback(std::vector<uint8_t>& pixels);
+
+        uint32_t BeginGPUZone(CommandBuffer& cmdBuf, const char* name);
+        void EndGPUZone(CommandBuffer& cmdBuf, uint32_t zone);
+        inline const std::vector<GPUZoneTiming>& GetGPUTimings() const { return m_GPUProfiler.GetTimings(); }
+
+        inline void AddFrameStat(FrameStat stat, uint64_t amount = 1) { m_FrameStats.Add(stat, amount); }
+        inline FrameStats GetFrameStats() const { return m_FrameStats.Get(); }
+
         // Internal
-        void Free(const FreeFn& fn);
-        void FreeQueue();
+        // Note: Destruction is deferred until no frame in flight can reference the resource anymore, see VulkanDeletionQueue
+        template<typename ...TArgs>
+        inline void Free(TArgs&& ...args) { m_DeletionQueue.Push(std::forward<TArgs>(args)...); }
+        // Note: Views & renderpasses also evict the cached framebuffers that reference them
+        inline void Free(VkImageView imageView) { m_FramebufferCache.Evict(imageView); m_DeletionQueue.Push(imageView); }
+        inline void Free(VkRenderPass renderpass) { m_FramebufferCache.Evict(renderpass); m_DeletionQueue.Push(renderpass); }
 
         void Recreate(uint32_t width, uint32_t height, bool vsync);
 
@@ -66,15 +96,41 @@ namespace Lunar::Internal
 
         ImageFormat GetColourFormat() const;
         ImageFormat GetDepthFormat() const;
+        ImageFormat GetCompressedFormat() const;
         std::vector<Image*> GetSwapChainImages();
+        inline uint32_t GetAcquiredImage() const { return m_SwapChain.GetAquiredImage(); }
 
         // Internal getters
         inline VulkanTaskManager& GetTaskManager() { return m_TaskManager; }
         inline VulkanSwapChain& GetVulkanSwapChain() { return m_SwapChain; }
+        inline VulkanCommandPools& GetCommandPools() { return m_CommandPools; }
+        inline VulkanTransientCommandPool& GetTransientCommandPool() { return m_TransientCommandPool; }
+        inline VulkanDeletionQueue& GetDeletionQueue() { return m_DeletionQueue; }
+        inline VulkanImageStreamer& GetImageStreamer() { return m_ImageStreamer; }
+        inline VulkanFramebufferCache& GetFramebufferCache() { return m_FramebufferCache; }
+        inline VulkanRenderTargetPool& GetRenderTargetPool() { return m_RenderTargetPool; }
+        inline VulkanGPUProfiler& GetGPUProfiler() { return m_GPUProfiler; }
 
         // Static methods
         static VulkanRenderer& GetRenderer(RendererID id);
 
+    private:
+        // Private methods
+        void SubmitDeferred(VulkanCommandBuffer& vkCmdBuf, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn);
+        void FlushSubmissions();
+
+    private:
+        struct DeferredSubmission
+        {
+        public:
+            Queue SubmitQueue = Queue::Graphics;
+            VkFence Fence = VK_NULL_HANDLE;
+
+            uint32_t WaitOffset = 0, WaitCount = 0; // Range into m_WaitInfos
+            VkCommandBufferSubmitInfo CommandBufferInfo = {};
+            VkSemaphoreSubmitInfo SignalInfo = {};
+        };
+
 	private:
         RendererID m_ID = 0;
         RendererSpecification m_Specification;
@@ -82,9 +138,21 @@ namespace Lunar::Internal
         VulkanSwapChain m_SwapChain = {};
 
         VulkanTaskManager m_TaskManager = {};
-
-        std::mutex m_FreeMutex = {};
-        std::queue<FreeFn> m_FreeQueue = {};
+        VulkanCommandPools m_CommandPools = {};
+        ThreadPool m_RecordWorkers = {}; // Note: Started by the first Record() call, every worker owns recording slot (index + 1)
+        VulkanTransientCommandPool m_TransientCommandPool = {};
+        VulkanDeletionQueue m_DeletionQueue = {};
+        VulkanImageStreamer m_ImageStreamer = {};
+        VulkanFramebufferCache m_FramebufferCache = {};
+        VulkanRenderTargetPool m_RenderTargetPool = {};
+        VulkanGPUProfiler m_GPUProfiler = {};
+        VulkanFrameStats m_FrameStats = {};
+
+        // Note: Only used with RendererSpecification::DeferredSubmission, the vectors are cleared (not freed) every frame
+        std::mutex m_SubmitMutex = {};
+        std::vector<DeferredSubmission> m_Submissions = { };
+        std::vector<VkSemaphoreSubmitInfo> m_WaitInfos = { };
+        std::vector<VkSubmitInfo2> m_SubmitInfos = { };
 	};
 
 }
\ No newline at end of file
@@ -11,6 +11,9 @@
 #include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
 #include "Lunar/Internal/API/Vulkan/VulkanImage.hpp"
 
+#include <array>
+#include <span>
+
 namespace Lunar::Internal
 {
 
@@ -24,10 +27,8 @@ namespace Lunar::Internal
 
         LU_ASSERT(((!m_Specification.ColourAttachment.empty()) || m_Specification.DepthAttachment), "No Colour or Depth image passed in.");
 
-        Vec2<uint32_t> size = GetSize();
-
+        // Note: Framebuffers are created on first use, see GetVkFramebuffer
         CreateRenderpass(renderer);
-        CreateFramebuffers(renderer, size.x, size.y);
     }
 
     void VulkanRenderpass::Destroy(const RendererID renderer)
@@ -38,17 +39,20 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanRenderpass::Resize(const RendererID renderer, uint32_t width, uint32_t height)
+    void VulkanRenderpass::Resize(const RendererID renderer, uint32_t, uint32_t)
     {
-        Renderer::GetRenderer(renderer).Free([frameBuffers = m_Framebuffers]()
-        {
-            auto device = VulkanContext::GetVulkanDevice().GetVkDevice();
+        // Note: Resized attachments have new views, so the new framebuffers get created lazily on the next Begin.
+        // We only drop the old ones here instead of waiting for them to go unused.
+        VulkanRenderer::GetRenderer(renderer).GetFramebufferCache().Evict(m_RenderPass);
+    }
 
-            for (auto& framebuffer : frameBuffers)
-                vkDestroyFramebuffer(device, framebuffer, nullptr);
-        });
+    void VulkanRenderpass::SetDepthAttachment(const RendererID renderer, Image* depth)
+    {
+        LU_ASSERT((m_Specification.DepthAttachment && depth), "[VkRenderpass] Can only swap the depth attachment of a renderpass that was created with one.");
+        LU_ASSERT((m_Specification.DepthAttachment->GetSpecification().Format == depth->GetSpecification().Format), "[VkRenderpass] The new depth attachment has a different format.");
 
-        CreateFramebuffers(renderer, width, height);
+        m_Specification.DepthAttachment = depth;
+        VulkanRenderer::GetRenderer(renderer).GetFramebufferCache().Evict(m_RenderPass);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +76,26 @@ namespace Lunar::Internal
         return size;
     }
 
+    VkFramebuffer VulkanRenderpass::GetVkFramebuffer(const RendererID renderer, uint32_t imageIndex)
+    {
+        std::array<VkImageView, 2> attachments = { };
+        uint32_t count = 0;
+
+        if (!m_Specification.ColourAttachment.empty())
+        {
+            // Note: If there is more than 1 colour attachment, there has to be one per swapchain image
+            Image* colour = ((m_Specification.ColourAttachment.size() == 1) ? m_Specification.ColourAttachment[0] : m_Specification.ColourAttachment[imageIndex]);
+            attachments[count++] = colour->GetInternalImage().GetVkImageView();
+        }
+        if (m_Specification.DepthAttachment)
+        {
+            attachments[count++] = m_Specification.DepthAttachment->GetInternalImage().GetVkImageView();
+        }
+
+        Vec2<uint32_t> size = GetSize();
+        return VulkanRenderer::GetRenderer(renderer).GetFramebufferCache().Get(m_RenderPass, std::span<const VkImageView>(attachments.data(), count), size.x, size.y);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +161,20 @@ namespace Lunar::Internal
 
         std::vector<VkSubpassDependency> dependencies = GetDependencies(m_Specification.Usage);
 
+        // Note: Depth images may be shared between renderpasses (see DepthImagePool), so depth
+        // writes of earlier passes have to finish before this one starts testing/clearing.
+        if (m_Specification.DepthAttachment)
+        {
+            VkSubpassDependency& depthDependency = dependencies.emplace_back();
+            depthDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+            depthDependency.dstSubpass = 0;
+            depthDependency.srcStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            depthDependency.dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            depthDependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            depthDependency.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            depthDependency.dependencyFlags = 0;
+        }
+
         VkRenderPassCreateInfo renderPassInfo = {};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
         renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
@@ -149,56 +187,10 @@ namespace Lunar::Internal
         VK_VERIFY(vkCreateRenderPass(VulkanContext::GetVulkanDevice().GetVkDevice(), &renderPassInfo, nullptr, &m_RenderPass));
     }
 
-    void VulkanRenderpass::CreateFramebuffers(const RendererID renderer, uint32_t width, uint32_t height)
-    {
-        // Framebuffer creation
-        m_Framebuffers.resize(VulkanRenderer::GetRenderer(renderer).GetVulkanSwapChain().GetSwapChainImages().size());
-        for (size_t i = 0; i < m_Framebuffers.size(); i++)
-        {
-            std::vector<VkImageView> attachments = { };
-            if (!m_Specification.ColourAttachment.empty())
-            {
-                if (m_Specification.ColourAttachment.size() == 1)
-                {
-                    VulkanImage& vkImage = m_Specification.ColourAttachment[0]->GetInternalImage();
-                    attachments.push_back(vkImage.GetVkImageView());
-                }
-                else // If the size is not equal to 1 it has to be equal to the amount of swapchain images
-                {
-                    VulkanImage& vkImage = m_Specification.ColourAttachment[i]->GetInternalImage();
-                    attachments.push_back(vkImage.GetVkImageView());
-                }
-            }
-            if (m_Specification.DepthAttachment)
-            {
-                VulkanImage& vkImage = m_Specification.DepthAttachment->GetInternalImage();
-                attachments.push_back(vkImage.GetVkImageView());
-            }
-
-            VkFramebufferCreateInfo framebufferInfo = {};
-            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-            framebufferInfo.renderPass = m_RenderPass;
-            framebufferInfo.attachmentCount = (uint32_t)attachments.size();
-            framebufferInfo.pAttachments = attachments.data();
-            framebufferInfo.width = width;
-            framebufferInfo.height = height;
-            framebufferInfo.layers = 1;
-
-            VK_VERIFY(vkCreateFramebuffer(VulkanContext::GetVulkanDevice().GetVkDevice(), &framebufferInfo, nullptr, &m_Framebuffers[i]));
-        }
-    }
-
     void VulkanRenderpass::DestroyRenderpass(const RendererID renderer)
     {
-        Renderer::GetRenderer(renderer).Free([frameBuffers = m_Framebuffers, renderpass = m_RenderPass]()
-        {
-            auto device = VulkanContext::GetVulkanDevice().GetVkDevice();
-
-            for (auto& framebuffer : frameBuffers)
-                vkDestroyFramebuffer(device, framebuffer, nullptr);
-
-            vkDestroyRenderPass(device, renderpass, nullptr);
-        });
+        // Note: Also evicts all cached framebuffers of this renderpass
+        VulkanRenderer::GetRenderer(renderer).Free(m_RenderPass);
     }
 
     std::vector<VkSubpassDependency> VulkanRenderpass::GetDependencies(RenderpassUsage usage)
@@ -332,4 +324,34 @@ namespace Lunar::Internal
 		return VK_ATTACHMENT_STORE_OP_NONE;
     }
 
+    SubpassContents VkSubpassContentsToSubpassContents(VkSubpassContents contents)
+    {
+        switch (contents)
+        {
+		case VK_SUBPASS_CONTENTS_INLINE:                        return SubpassContents::Inline;
+		case VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS:     return SubpassContents::SecondaryCommandBuffers;
+
+        default:
+            LU_ASSERT(false, "[VkRenderpass] Unknown VkSubpassContents!");
+            break;
+        }
+
+		return SubpassContents::Inline;
+    }
+
+    VkSubpassContents SubpassContentsToVkSubpassContents(SubpassContents contents)
+    {
+        switch (contents)
+        {
+		case SubpassContents::Inline:                           return VK_SUBPASS_CONTENTS_INLINE;
+		case SubpassContents::SecondaryCommandBuffers:          return VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+
+        default:
+            LU_ASSERT(false, "[VkRenderpass] Unknown SubpassContents!");
+            break;
+        }
+
+		return VK_SUBPASS_CONTENTS_INLINE;
+    }
+
 }
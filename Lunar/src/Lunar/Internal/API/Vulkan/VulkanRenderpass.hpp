@@ -17,6 +17,8 @@ namespace Lunar::Internal
 	VkAttachmentLoadOp LoadOperationToVkAttachmentLoadOp(LoadOperation loadOp);
 	StoreOperation VkAttachmentStoreOpToStoreOperation(VkAttachmentStoreOp storeOp);
 	VkAttachmentStoreOp StoreOperationToVkAttachmentStoreOp(StoreOperation storeOp);
+	SubpassContents VkSubpassContentsToSubpassContents(VkSubpassContents contents);
+	VkSubpassContents SubpassContentsToVkSubpassContents(SubpassContents contents);
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// VulkanRenderpass
@@ -37,6 +39,8 @@ namespace Lunar::Internal
 		// Methods
 		void Resize(const RendererID renderer, uint32_t width, uint32_t height);
 
+		void SetDepthAttachment(const RendererID renderer, Image* depth); // Note: Has to have the same format as the original
+
 		// Getters
 		Vec2<uint32_t> GetSize() const;
 
@@ -45,12 +49,11 @@ namespace Lunar::Internal
 
 		// Internal
 		inline VkRenderPass GetVkRenderPass() const { return m_RenderPass; }
-		inline std::vector<VkFramebuffer>& GetVkFrameBuffers() { return m_Framebuffers; };
+		VkFramebuffer GetVkFramebuffer(const RendererID renderer, uint32_t imageIndex); // Note: Comes from the renderer's VulkanFramebufferCache
 
 	private:
 		// Private methods
 		void CreateRenderpass(const RendererID renderer);
-		void CreateFramebuffers(const RendererID renderer, uint32_t width, uint32_t height);
 		void DestroyRenderpass(const RendererID renderer);
 
 		std::vector<VkSubpassDependency> GetDependencies(RenderpassUsage usage);
@@ -61,7 +64,6 @@ namespace Lunar::Internal
 		CommandBuffer* m_CommandBuffer = nullptr;
 
 		VkRenderPass m_RenderPass = VK_NULL_HANDLE;
-		std::vector<VkFramebuffer> m_Framebuffers = { };
 
 		friend class VulkanRenderer;
 	};
@@ -59,7 +59,7 @@ namespace Lunar::Internal
         case ShaderStage::MeshEXT: /*Also NV*/          return shaderc_glsl_mesh_shader;
 
         default:
-            LU_LOG_ERROR("[VulkanShaderCompiler] ShaderStage passed in is currently not supported.");
+            LU_LOG_CAT(Error, Vulkan, "[VulkanShaderCompiler] ShaderStage passed in is currently not supported.");
             break;
         }
 
@@ -101,13 +101,8 @@ namespace Lunar::Internal
     {
         // Note: This might be redundant since shaders are only usefuls when a pipeline needs to be created.
         // But better safe than sorry.
-        Renderer::GetRenderer(renderer).Free([shaders = m_Shaders]()
-        {
-            auto device = VulkanContext::GetVulkanDevice().GetVkDevice();
-
-            for (auto& [stage, shader] : shaders)
-                vkDestroyShaderModule(device, shader, nullptr);
-        });
+        for (auto& [stage, shader] : m_Shaders)
+            VulkanRenderer::GetRenderer(renderer).Free(shader);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -4,6 +4,8 @@
 #include "Lunar/Internal/IO/Print.hpp"
 #include "Lunar/Internal/Utils/Profiler.hpp"
 
+#include "Lunar/Internal/Memory/ScratchAllocator.hpp"
+
 #include "Lunar/Internal/Core/Window.hpp"
 
 #include "Lunar/Internal/API/Vulkan/VulkanContext.hpp"
@@ -24,21 +26,21 @@ namespace Lunar::Internal
 	{
 		m_RendererID = renderer;
 		m_Window = window;
+		m_Headless = window->GetSpecification().Headless;
+
+		// Note: Without a surface we render into our own images, BGRA matches what most surfaces prefer
+		if (m_Headless)
+		{
+			m_ColourFormat = VK_FORMAT_B8G8R8A8_UNORM;
+			m_ColourSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+			return;
+		}
 
 		#if defined(LU_PLATFORM_DESKTOP)
         VK_VERIFY(glfwCreateWindowSurface(VulkanContext::GetVkInstance(), static_cast<GLFWwindow*>(window->GetNativeWindow()), nullptr, &m_Surface));
 		#endif
 
 		FindImageFormatAndColorSpace();
-
-		QueueFamilyIndices queueFamilyIndices = QueueFamilyIndices::Find(m_Surface, VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice());
-
-		VkCommandPoolCreateInfo poolInfo = {};
-		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-		poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // Allows us to reset the command buffer and reuse it.
-		poolInfo.queueFamilyIndex = queueFamilyIndices.GraphicsFamily.value();
-
-		VK_VERIFY(vkCreateCommandPool(VulkanContext::GetVulkanDevice().GetVkDevice(), &poolInfo, nullptr, &m_CommandPool));
 	}
 
 	void VulkanSwapChain::Destroy()
@@ -54,12 +56,14 @@ namespace Lunar::Internal
 		for (auto& image : m_Images)
 			image.Destroy(m_RendererID);
 
-		vkDestroyCommandPool(device.GetVkDevice(), m_CommandPool, nullptr);
-
 		for (size_t i = 0; i < m_ImageAvailableSemaphores.size(); i++)
             vkDestroySemaphore(device.GetVkDevice(), m_ImageAvailableSemaphores[i], nullptr);
 
-		vkDestroySurfaceKHR(VulkanContext::GetVkInstance(), m_Surface, nullptr);
+		for (auto& fence : m_PresentFences)
+			vkDestroyFence(device.GetVkDevice(), fence, nullptr);
+
+		if (m_Surface)
+			vkDestroySurfaceKHR(VulkanContext::GetVkInstance(), m_Surface, nullptr);
 	}
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +74,12 @@ namespace Lunar::Internal
 		if (width == 0 || height == 0)
             return;
 
+		if (m_Headless)
+		{
+			ResizeHeadless(width, height, framesInFlight);
+			return;
+		}
+
 		///////////////////////////////////////////////////////////
 		// SwapChain
 		///////////////////////////////////////////////////////////
@@ -232,10 +242,7 @@ namespace Lunar::Internal
                 VulkanImage& src = m_Images[i];
 
 				// Destroy old image view
-                m_Window->GetRenderer().GetInternalRenderer().Free([device = device, imageView = src.m_ImageView]()
-				{
-					vkDestroyImageView(device, imageView, nullptr);
-				});
+                m_Window->GetRenderer().GetInternalRenderer().Free(src.m_ImageView);
 
 				// Set new data
 				src.m_ImageSpecification = specs;
@@ -275,6 +282,13 @@ namespace Lunar::Internal
 		LU_PROFILE("VkSwapChain::AcquireImage()");
 		uint32_t imageIndex = 0;
 
+		// Note: Every frame in flight owns one image, the frame's fences have already been waited on
+		if (m_Headless)
+		{
+			m_AcquiredImage = m_CurrentFrame;
+			return m_AcquiredImage;
+		}
+
 		VkResult result = vkAcquireNextImageKHR(VulkanContext::GetVulkanDevice().GetVkDevice(), m_SwapChain, std::numeric_limits<uint64_t>::max(), m_ImageAvailableSemaphores[m_CurrentFrame], VK_NULL_HANDLE, &imageIndex);
 		if (result == VK_ERROR_OUT_OF_DATE_KHR)
 		{
@@ -282,7 +296,7 @@ namespace Lunar::Internal
 		}
 		else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
 		{
-			LU_LOG_ERROR("[VulkanSwapChain] Failed to acquire SwapChain image!");
+			LU_LOG_LIMITED(Error, Vulkan, "[VulkanSwapChain] Failed to acquire SwapChain image!");
 		}
 
 		m_AcquiredImage = imageIndex;
@@ -332,4 +346,72 @@ namespace Lunar::Internal
 		}
 	}
 
+
+	void VulkanSwapChain::ResizeHeadless(uint32_t width, uint32_t height, uint8_t framesInFlight)
+	{
+		ImageSpecification specs = {
+			.Usage = ImageUsage::Colour | ImageUsage::TransferSrc,
+			.Layout = ImageLayout::Undefined,
+			.Format = VkFormatToImageFormat(m_ColourFormat),
+			.Width = width,
+			.Height = height,
+			.MipMaps = false
+		};
+
+		// Note: Resizing defers destruction of the old images through the deletion queue
+		if (m_Images.empty())
+		{
+			m_Images.resize(static_cast<size_t>(framesInFlight));
+			for (auto& image : m_Images)
+				image.Init(m_RendererID, specs, {});
+		}
+		else
+		{
+			for (auto& image : m_Images)
+				image.Resize(m_RendererID, width, height);
+		}
+
+		// Note: The renderer expects the acquired image to be in PresentSrcKHR
+		for (auto& image : m_Images)
+			image.Transition(m_RendererID, ImageLayout::Undefined, ImageLayout::PresentSrcKHR);
+
+		if (m_PresentFences.empty())
+		{
+			VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+			m_PresentFences.resize(static_cast<size_t>(framesInFlight));
+
+			VkFenceCreateInfo fenceInfo = {};
+			fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+			for (auto& fence : m_PresentFences)
+				VK_VERIFY(vkCreateFence(device, &fenceInfo, nullptr, &fence));
+		}
+	}
+
+	void VulkanSwapChain::PresentHeadless(const std::vector<VkSemaphore>& waitSemaphores)
+	{
+		LU_PROFILE("VkSwapChain::PresentHeadless()");
+
+		// Note: There is no presentation engine to consume the frame's semaphores, so an empty
+		// submission waits on them instead. Otherwise they'd still be signaled when the frame comes back around.
+		std::pmr::vector<VkSemaphoreSubmitInfo> waitInfos(ScratchAllocator::Get());
+		waitInfos.reserve(waitSemaphores.size());
+		for (VkSemaphore semaphore : waitSemaphores)
+		{
+			VkSemaphoreSubmitInfo& waitInfo = waitInfos.emplace_back();
+			waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+			waitInfo.semaphore = semaphore;
+			waitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+		}
+
+		VkSubmitInfo2 submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+		submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(waitInfos.size());
+		submitInfo.pWaitSemaphoreInfos = waitInfos.data();
+
+		// Note: The fence is waited on (& reset) by the next BeginFrame of this frame
+		VkFence fence = m_PresentFences[m_CurrentFrame];
+		VK_VERIFY(vkQueueSubmit2(VulkanContext::GetVulkanDevice().GetGraphicsQueue(), 1, &submitInfo, fence));
+		m_Window->GetRenderer().GetInternalRenderer().GetTaskManager().Add(fence);
+	}
 }
\ No newline at end of file
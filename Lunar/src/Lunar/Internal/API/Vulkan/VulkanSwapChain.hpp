@@ -39,7 +39,7 @@ namespace Lunar::Internal
         inline std::vector<VulkanImage>& GetSwapChainImages() { return m_Images; }
 
         inline VkSurfaceKHR GetVkSurface() const { return m_Surface; }
-        inline VkCommandPool GetVkCommandPool() const { return m_CommandPool; }
+        inline bool IsHeadless() const { return m_Headless; }
 
         inline VkSemaphore GetImageAvailableSemaphore(uint32_t index) const { return m_ImageAvailableSemaphores[index]; }
         inline VkSemaphore GetCurrentImageAvailableSemaphore() const { return GetImageAvailableSemaphore(m_CurrentFrame); }
@@ -49,6 +49,9 @@ namespace Lunar::Internal
         uint32_t AcquireNextImage();
         void FindImageFormatAndColorSpace();
 
+        void ResizeHeadless(uint32_t width, uint32_t height, uint8_t framesInFlight);
+        void PresentHeadless(const std::vector<VkSemaphore>& waitSemaphores);
+
     private:
 		RendererID m_RendererID = 0;
         Window* m_Window = nullptr;
@@ -58,10 +61,12 @@ namespace Lunar::Internal
 
         std::vector<VulkanImage> m_Images = { };
 
-        VkCommandPool m_CommandPool = VK_NULL_HANDLE;
-
         std::vector<VkSemaphore> m_ImageAvailableSemaphores = { };
 
+        // Note: Only used when headless, the images are regular images & the fences guard the semaphore waits of the 'present'
+        bool m_Headless = false;
+        std::vector<VkFence> m_PresentFences = { };
+
         VkFormat m_ColourFormat = VK_FORMAT_UNDEFINED;
         VkColorSpaceKHR m_ColourSpace = VK_COLOR_SPACE_MAX_ENUM_KHR;
 
@@ -29,13 +29,14 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Add methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanTaskManager::Add(VulkanCommandBuffer& cmdBuf, ExecutionPolicy policy)
+    void VulkanTaskManager::Add(VulkanCommandBuffer& cmdBuf, ExecutionPolicy policy, bool addFence)
     {
         LU_PROFILE("VkTaskManager::Add(Cmd, Policy)");
         std::scoped_lock<std::mutex> lock(m_ThreadSafety);
 
         uint32_t frame = VulkanRenderer::GetRenderer(m_RendererID).GetVulkanSwapChain().GetCurrentFrame();
-        m_Fences[frame].push_back(cmdBuf.GetVkInFlightFence(frame));
+        if (addFence)
+            m_Fences[frame].push_back(cmdBuf.GetVkInFlightFence(frame));
 
         if (policy & ExecutionPolicy::InOrder)
             m_Semaphores[frame].first.push_back(cmdBuf.GetVkRenderFinishedSemaphore(frame));
@@ -52,6 +53,15 @@ namespace Lunar::Internal
         m_Semaphores[frame].first.push_back(semaphore);
     }
 
+    void VulkanTaskManager::Add(VkFence fence)
+    {
+        LU_PROFILE("VkTaskManager::Add(Fence)");
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        uint32_t frame = VulkanRenderer::GetRenderer(m_RendererID).GetVulkanSwapChain().GetCurrentFrame();
+        m_Fences[frame].push_back(fence);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Remove & Reset methods
     ////////////////////////////////////////////////////////////////////////////////////
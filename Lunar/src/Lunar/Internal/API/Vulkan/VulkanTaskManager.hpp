@@ -27,8 +27,9 @@ namespace Lunar::Internal
 		void Destroy();
 
         // Add methods
-        void Add(VulkanCommandBuffer& cmdBuf, ExecutionPolicy policy);
+        void Add(VulkanCommandBuffer& cmdBuf, ExecutionPolicy policy, bool addFence = true); // Note: addFence is false for deferred submissions, their fence is added on flush
         void Add(VkSemaphore semaphore); // Internal function for swapchain image available semaphore
+        void Add(VkFence fence); // Internal function for the fence of a batched submission
 
         // Remove & Reset methods
         void Remove(VkFence fence); // It removes the fence from current frame if it exists
@@ -48,6 +48,7 @@ namespace Lunar::Internal
 
 		// Setters
 		inline void SetTitle(std::string_view title) { m_Window.SetTitle(title); }
+		inline void SetSize(uint32_t width, uint32_t height) { m_Window.SetSize(width, height); } // Note: Results in a WindowResizeEvent
 		inline void SetVSync(bool vsync) { m_Window.SetVSync(vsync); }
 
 		// Additional getters
@@ -22,12 +22,14 @@ namespace Lunar::Internal
         // Window
         std::string_view Title = {};
         uint32_t Width = 0, Height = 0;
+        bool Headless = false; // Note: No OS window & no surface, the renderer draws into a ring of offscreen images instead
 
         EventCallbackFn EventCallback = nullptr;
 
         // Renderer
         bool VSync = false;
         BufferMode Buffers = BufferMode::Triple;
+        bool DeferredSubmission = false;
     };
 
 }
\ No newline at end of file
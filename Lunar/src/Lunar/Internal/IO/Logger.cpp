@@ -0,0 +1,448 @@
+#include "lupch.h"
+#include "Logger.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/MPSCQueue.hpp"
+
+#include <ctime>
+#include <mutex>
+#include <limits>
+#include <atomic>
+#include <thread>
+#include <format>
+#include <condition_variable>
+
+namespace Lunar::Internal
+{
+
+    namespace
+    {
+        static int64_t GetSteadyNow()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        struct LogRecord
+        {
+        public:
+            Log::Level Level = Log::Level::Trace;
+            bool Raw = false;
+
+            std::chrono::system_clock::time_point Time = {};
+            std::string Message = {};
+        };
+
+        class LoggerBackend
+        {
+        public:
+            LoggerBackend()
+            {
+                m_Sinks.push_back(std::make_unique<ConsoleLogSink>());
+                m_Thread = std::thread([this]() { Run(); });
+            }
+
+            ~LoggerBackend()
+            {
+                m_Running.store(false, std::memory_order_relaxed);
+                Wake();
+
+                m_Thread.join();
+            }
+
+            void Push(LogRecord&& record, bool block)
+            {
+                while (!m_Queue.TryPush(std::move(record)))
+                {
+                    if (!block)
+                    {
+                        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    Wake();
+                    std::this_thread::yield();
+                }
+
+                m_Pushed.fetch_add(1, std::memory_order_release);
+                Wake();
+            }
+
+            void Flush()
+            {
+                const uint64_t target = m_Pushed.load(std::memory_order_acquire);
+
+                uint64_t written = m_Written.load(std::memory_order_acquire);
+                while (written < target)
+                {
+                    m_Written.wait(written, std::memory_order_acquire);
+                    written = m_Written.load(std::memory_order_acquire);
+                }
+            }
+
+            void AddSink(std::unique_ptr<LogSink>&& sink)
+            {
+                std::scoped_lock<std::mutex> lock(m_SinkMutex);
+                m_Sinks.push_back(std::move(sink));
+            }
+
+            void ClearSinks()
+            {
+                std::scoped_lock<std::mutex> lock(m_SinkMutex);
+                m_Sinks.clear();
+            }
+
+            void AddRateLimiter(Log::RateLimiter* limiter)
+            {
+                std::scoped_lock<std::mutex> lock(m_RateLimiterMutex);
+                m_RateLimiters.push_back(limiter);
+            }
+
+            void RemoveRateLimiter(Log::RateLimiter* limiter)
+            {
+                std::scoped_lock<std::mutex> lock(m_RateLimiterMutex);
+                std::erase(m_RateLimiters, limiter);
+            }
+
+            inline uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+            // Note: Only the first push after the logger thread went to sleep pays for the wake up
+            void Wake()
+            {
+                if (m_Pending.fetch_add(1, std::memory_order_release) == 0)
+                {
+                    { std::scoped_lock<std::mutex> lock(m_WakeMutex); } // Note: So the notify can't land between the logger thread's check & its wait
+                    m_WakeCondition.notify_one();
+                }
+            }
+
+        private:
+            void Run()
+            {
+                while (true)
+                {
+                    // Note: Reset before draining, so a push during the drain makes the wait return right away
+                    m_Pending.store(0, std::memory_order_relaxed);
+                    const int64_t deadline = Drain();
+
+                    if (!m_Running.load(std::memory_order_relaxed))
+                        break;
+
+                    // Note: Only wakes up by itself when a rate limiter has suppressed counts to write
+                    std::unique_lock<std::mutex> lock(m_WakeMutex);
+                    auto woken = [this]() { return m_Pending.load(std::memory_order_acquire) != 0; };
+                    if (deadline == std::numeric_limits<int64_t>::max())
+                        m_WakeCondition.wait(lock, woken);
+                    else
+                        m_WakeCondition.wait_until(lock, std::chrono::steady_clock::time_point(std::chrono::nanoseconds(deadline)), woken);
+                }
+            }
+
+            int64_t Drain() // Note: Returns when the next suppressed count has to be written
+            {
+                uint64_t written = 0;
+                bool wroteOwn = false; // Note: Messages from the logger itself, these don't count towards Flush()
+
+                std::scoped_lock<std::mutex> lock(m_SinkMutex);
+                LogRecord record = {};
+                while (m_Queue.TryPop(record))
+                {
+                    Write(record.Level, record.Raw, record.Time, record.Message);
+                    written++;
+                }
+
+                const uint64_t dropped = m_Dropped.load(std::memory_order_relaxed);
+                if (dropped != m_ReportedDropped)
+                {
+                    Write(Log::Level::Warn, false, std::chrono::system_clock::now(), std::format("[Logger] Dropped {0} messages, the queue was full.", dropped - m_ReportedDropped));
+                    m_ReportedDropped = dropped;
+                    wroteOwn = true;
+                }
+
+                // Write the suppressed counts no later message picked up
+                int64_t deadline = std::numeric_limits<int64_t>::max();
+                {
+                    const int64_t now = GetSteadyNow();
+
+                    std::scoped_lock<std::mutex> limiterLock(m_RateLimiterMutex);
+                    for (Log::RateLimiter* limiter : m_RateLimiters)
+                    {
+                        deadline = std::min(deadline, limiter->FlushExpired(now, [&](uint64_t key, uint64_t suppressed)
+                        {
+                            if (key == 0)
+                                Write(limiter->GetLevel(), false, std::chrono::system_clock::now(), std::format("[Logger] Suppressed {0} more messages like \"{1}\".", suppressed, limiter->GetFormat()));
+                            else
+                                Write(limiter->GetLevel(), false, std::chrono::system_clock::now(), std::format("[Logger] Suppressed {0} more messages like \"{1}\" (key {2}).", suppressed, limiter->GetFormat(), key));
+
+                            wroteOwn = true;
+                        }));
+                    }
+                }
+
+                if (written == 0 && !wroteOwn)
+                    return deadline;
+
+                for (auto& sink : m_Sinks)
+                    sink->Flush();
+
+                if (written != 0)
+                {
+                    m_Written.fetch_add(written, std::memory_order_release);
+                    m_Written.notify_all();
+                }
+
+                return deadline;
+            }
+
+            void Write(Log::Level level, bool raw, std::chrono::system_clock::time_point time, std::string_view message)
+            {
+                const LogEntry entry = { .Level = level, .Raw = raw, .Time = GetTime(time), .Message = message };
+                for (auto& sink : m_Sinks)
+                    sink->Write(entry);
+            }
+
+            // Note: The string only changes once a second, so most messages skip localtime & strftime
+            std::string_view GetTime(std::chrono::system_clock::time_point time)
+            {
+                const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+                if (seconds != m_CachedSecond)
+                {
+                    std::tm localTime = *std::localtime(&seconds); // Note: Only called from the logger thread
+                    m_CachedLength = std::strftime(m_CachedTime, sizeof(m_CachedTime), "%H:%M:%S", &localTime);
+                    m_CachedSecond = seconds;
+                }
+
+                return std::string_view(m_CachedTime, m_CachedLength);
+            }
+
+        private:
+            MPSCQueue<LogRecord, Logger::Capacity> m_Queue = {};
+
+            std::atomic<uint32_t> m_Pending = 0;
+            std::mutex m_WakeMutex = {};
+            std::condition_variable m_WakeCondition = {};
+
+            std::atomic<uint64_t> m_Pushed = 0;
+            std::atomic<uint64_t> m_Written = 0;
+            std::atomic<uint64_t> m_Dropped = 0;
+            uint64_t m_ReportedDropped = 0;
+
+            std::mutex m_SinkMutex = {};
+            std::vector<std::unique_ptr<LogSink>> m_Sinks = { };
+
+            std::mutex m_RateLimiterMutex = {};
+            std::vector<Log::RateLimiter*> m_RateLimiters = { };
+
+            std::time_t m_CachedSecond = -1;
+            char m_CachedTime[16] = {};
+            size_t m_CachedLength = 0;
+
+            std::atomic<bool> m_Running = true;
+            std::thread m_Thread = {};
+        };
+
+        static LoggerBackend& GetBackend()
+        {
+            static LoggerBackend backend = {};
+            return backend;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RateLimiter
+    ////////////////////////////////////////////////////////////////////////////////////
+    Log::RateLimiter::RateLimiter(Level level, std::string_view format)
+        : m_Level(level), m_Format(format)
+    {
+        GetBackend().AddRateLimiter(this);
+    }
+
+    Log::RateLimiter::~RateLimiter()
+    {
+        GetBackend().RemoveRateLimiter(this);
+    }
+
+    bool Log::RateLimiter::Allow(uint64_t key, uint64_t& suppressed)
+    {
+        Slot* slot = GetSlot(key);
+        if (!slot) [[unlikely]]
+            return true;
+
+        const int64_t now = GetSteadyNow();
+
+        // Note: Only one of the threads racing for an expired slot gets through
+        int64_t next = slot->Next.load(std::memory_order_relaxed);
+        if (now < next || !slot->Next.compare_exchange_strong(next, now + Interval.count(), std::memory_order_relaxed))
+        {
+            // Note: The first suppressed message wakes the logger thread, so it writes the count if nothing else does
+            if (slot->Suppressed.fetch_add(1, std::memory_order_relaxed) == 0)
+                GetBackend().Wake();
+
+            return false;
+        }
+
+        suppressed = slot->Suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    template<typename TFunc>
+    int64_t Log::RateLimiter::FlushExpired(int64_t now, TFunc&& write)
+    {
+        int64_t deadline = std::numeric_limits<int64_t>::max();
+        for (Slot& slot : m_Slots)
+        {
+            if (slot.Status.load(std::memory_order_acquire) != Slot::Ready || slot.Suppressed.load(std::memory_order_relaxed) == 0)
+                continue;
+
+            const int64_t next = slot.Next.load(std::memory_order_relaxed);
+            if (now < next)
+            {
+                deadline = std::min(deadline, next);
+                continue;
+            }
+
+            // Note: Exchanged, so a message getting through at the same time can't report the same count
+            const uint64_t suppressed = slot.Suppressed.exchange(0, std::memory_order_relaxed);
+            if (suppressed > 0)
+                write(slot.Key, suppressed);
+        }
+
+        return deadline;
+    }
+
+    Log::RateLimiter::Slot* Log::RateLimiter::GetSlot(uint64_t key)
+    {
+        // Note: Open addressing, slots are claimed once & never released
+        const size_t start = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) % Capacity;
+        for (size_t i = 0; i < Capacity; i++)
+        {
+            Slot& slot = m_Slots[(start + i) % Capacity];
+
+            uint32_t status = slot.Status.load(std::memory_order_acquire);
+            if (status == Slot::Empty)
+            {
+                if (slot.Status.compare_exchange_strong(status, Slot::Claiming, std::memory_order_acquire))
+                {
+                    slot.Key = key;
+                    slot.Status.store(Slot::Ready, std::memory_order_release);
+                    return &slot;
+                }
+            }
+
+            // Note: Another thread is claiming this slot, its key is only readable once it's done
+            while (status == Slot::Claiming)
+            {
+                std::this_thread::yield();
+                status = slot.Status.load(std::memory_order_acquire);
+            }
+
+            if (slot.Key == key)
+                return &slot;
+        }
+
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Sinks
+    ////////////////////////////////////////////////////////////////////////////////////
+    void ConsoleLogSink::Write(const LogEntry& entry)
+    {
+        if (entry.Raw)
+        {
+            std::cout << entry.Message << Log::Colour::Reset;
+            return;
+        }
+
+        switch (entry.Level)
+        {
+        case Log::Level::Trace:     std::cout << Log::Colour::Reset; break;
+        case Log::Level::Info:      std::cout << Log::Colour::GreenFG; break;
+        case Log::Level::Warn:      std::cout << Log::Colour::BrightYellowFG; break;
+        case Log::Level::Error:     std::cout << Log::Colour::BrightRedFG; break;
+        case Log::Level::Fatal:     std::cout << Log::Colour::RedBG; break;
+
+        default:
+            break;
+        }
+
+        std::cout << '[' << entry.Time << "] [" << Log::LevelTag(entry.Level) << "]: " << entry.Message << Log::Colour::Reset << '\n';
+    }
+
+    void ConsoleLogSink::Flush()
+    {
+        std::cout.flush();
+    }
+
+    FileLogSink::FileLogSink(const std::filesystem::path& path)
+        : m_File(path, std::ios::out | std::ios::trunc)
+    {
+    }
+
+    void FileLogSink::Write(const LogEntry& entry)
+    {
+        if (entry.Raw)
+            m_File << entry.Message;
+        else
+            m_File << '[' << entry.Time << "] [" << Log::LevelTag(entry.Level) << "]: " << entry.Message << '\n';
+    }
+
+    void FileLogSink::Flush()
+    {
+        m_File.flush();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void Logger::SetLevel(Log::Level level)
+    {
+        for (auto& categoryLevel : s_Levels)
+            categoryLevel.store(level, std::memory_order_relaxed);
+    }
+
+    void Logger::SetLevel(Log::Category category, Log::Level level)
+    {
+        s_Levels[static_cast<size_t>(category)].store(level, std::memory_order_relaxed);
+    }
+
+    void Logger::Push(Log::Level level, std::string&& message)
+    {
+        LogRecord record = { .Level = level, .Raw = false, .Time = std::chrono::system_clock::now(), .Message = std::move(message) };
+
+        // Note: Fatal messages precede a debug break or abort, so they have to be written before returning
+        if (level == Log::Level::Fatal)
+        {
+            GetBackend().Push(std::move(record), true);
+            GetBackend().Flush();
+            return;
+        }
+
+        GetBackend().Push(std::move(record), false);
+    }
+
+    void Logger::PushRaw(std::string&& text)
+    {
+        GetBackend().Push({ .Level = Log::Level::Trace, .Raw = true, .Time = std::chrono::system_clock::now(), .Message = std::move(text) }, false);
+    }
+
+    void Logger::Flush()
+    {
+        GetBackend().Flush();
+    }
+
+    void Logger::AddSink(std::unique_ptr<LogSink>&& sink)
+    {
+        GetBackend().AddSink(std::move(sink));
+    }
+
+    void Logger::ClearSinks()
+    {
+        GetBackend().ClearSinks();
+    }
+
+    uint64_t Logger::GetDroppedCount()
+    {
+        return GetBackend().GetDroppedCount();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Levels
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace Log
+    {
+        enum class Level : uint8_t { Trace, Info, Warn, Error, Fatal, Off };
+
+        enum class Category : uint8_t { General, Vulkan, Renderer, Batch, Window, IO, Count };
+
+        constexpr std::string_view LevelTag(Level level)
+        {
+            switch (level)
+            {
+            case Level::Trace:  return "T";
+            case Level::Info:   return "I";
+            case Level::Warn:   return "W";
+            case Level::Error:  return "E";
+            case Level::Fatal:  return "F";
+
+            default:
+                break;
+            }
+
+            return "?";
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // RateLimiter
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Note: Lives at a call site (see LU_LOG_LIMITED), lets one message per key through every Interval
+        // & counts the rest, the count is appended to the next message that gets through.
+        // Counts that no later message picks up are written by the logger thread once their interval ends.
+        // Note 2: Every key gets its own slot, so distinct keys never share a limit. Once all Capacity slots
+        // of a call site are taken new keys aren't limited at all (rather than suppressing unrelated messages).
+        class RateLimiter
+        {
+        public:
+            constexpr static const std::chrono::nanoseconds Interval = std::chrono::seconds(1);
+            constexpr static const size_t Capacity = 64; // Note: Distinct keys per call site
+        public:
+            // Constructor & Destructor
+            RateLimiter(Level level, std::string_view format); // Note: The format has to outlive the limiter, e.g. a string literal
+            ~RateLimiter();
+
+            // Methods
+            bool Allow(uint64_t key, uint64_t& suppressed);
+
+            // Note: Only called by the logger thread, calls write(key, suppressed) for every key whose interval
+            // ended with suppressed messages. Returns when the next one ends (steady_clock nanoseconds), or INT64_MAX.
+            template<typename TFunc>
+            int64_t FlushExpired(int64_t now, TFunc&& write);
+
+            // Getters
+            inline Level GetLevel() const { return m_Level; }
+            inline std::string_view GetFormat() const { return m_Format; }
+
+        private:
+            struct Slot
+            {
+            public:
+                enum State : uint32_t { Empty = 0, Claiming, Ready };
+
+                std::atomic<uint32_t> Status = Empty;
+                uint64_t Key = 0; // Note: Only valid once Status is Ready
+
+                std::atomic<int64_t> Next = 0; // Note: steady_clock nanoseconds
+                std::atomic<uint64_t> Suppressed = 0;
+            };
+
+        private:
+            // Private methods
+            Slot* GetSlot(uint64_t key);
+
+        private:
+            Level m_Level;
+            std::string_view m_Format;
+
+            std::array<Slot, Capacity> m_Slots = { };
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Sinks
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct LogEntry
+    {
+    public:
+        Log::Level Level = Log::Level::Trace;
+        bool Raw = false; // Note: Print/PrintF/PrintLn output, without time & tag
+
+        std::string_view Time = {}; // Note: HH:MM:SS
+        std::string_view Message = {};
+    };
+
+    // Note: Sinks are only called from the logger thread
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+
+        virtual void Write(const LogEntry& entry) = 0;
+        virtual void Flush() {} // Note: Called after every drained batch
+    };
+
+    class ConsoleLogSink : public LogSink
+    {
+    public:
+        void Write(const LogEntry& entry) override;
+        void Flush() override;
+    };
+
+    class FileLogSink : public LogSink
+    {
+    public:
+        FileLogSink(const std::filesystem::path& path);
+
+        void Write(const LogEntry& entry) override;
+        void Flush() override;
+
+    private:
+        std::ofstream m_File;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Logger
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Log calls format their message on the calling thread & push it into a lock-free ring,
+    // a background thread writes them to the sinks. When the ring is full messages are dropped
+    // (& counted) instead of stalling the caller, except for fatal ones which also flush.
+    // Note 2: Messages below their category's level are discarded before they're formatted.
+    class Logger
+    {
+    public:
+        constexpr static const size_t Capacity = 4096; // Note: Messages in flight
+    public:
+        // Static methods
+        static void SetLevel(Log::Level level); // Note: For all categories
+        static void SetLevel(Log::Category category, Log::Level level);
+        static inline Log::Level GetLevel(Log::Category category) { return s_Levels[static_cast<size_t>(category)].load(std::memory_order_relaxed); }
+        static inline bool IsEnabled(Log::Category category, Log::Level level) { return (level >= GetLevel(category)) || (level == Log::Level::Fatal); } // Note: Fatal messages always pass
+
+        static void Push(Log::Level level, std::string&& message);
+        static void PushRaw(std::string&& text);
+
+        static void Flush(); // Note: Blocks until everything pushed so far has been written
+
+        static void AddSink(std::unique_ptr<LogSink>&& sink); // Note: The console sink is added by default
+        static void ClearSinks();
+
+        static uint64_t GetDroppedCount();
+
+    private:
+        inline static std::array<std::atomic<Log::Level>, static_cast<size_t>(Log::Category::Count)> s_Levels = { };
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "lupch.h"
+#include "MappedFile.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+
+#if defined(LU_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#elif defined(LU_PLATFORM_LINUX) || defined(LU_PLATFORM_MACOS)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        #if defined(LU_PLATFORM_WINDOWS)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size = {};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_FileHandle = file;
+        m_MappingHandle = mapping;
+        m_Data = static_cast<const uint8_t*>(data);
+        m_Size = static_cast<size_t>(size.QuadPart);
+
+        #elif defined(LU_PLATFORM_LINUX) || defined(LU_PLATFORM_MACOS)
+        int file = open(path.c_str(), O_RDONLY);
+        if (file == -1)
+            return false;
+
+        struct stat info = {};
+        if (fstat(file, &info) == -1 || info.st_size == 0)
+        {
+            close(file);
+            return false;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file); // Note: The mapping keeps its own reference to the file
+
+        if (data == MAP_FAILED)
+            return false;
+
+        madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+        m_Data = static_cast<const uint8_t*>(data);
+        m_Size = static_cast<size_t>(info.st_size);
+
+        #else
+        LU_LOG_CAT(Error, IO, "[MappedFile] Memory mapped files are not supported on this platform.");
+        return false;
+        #endif
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data == nullptr)
+            return;
+
+        #if defined(LU_PLATFORM_WINDOWS)
+        UnmapViewOfFile(m_Data);
+        CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+        CloseHandle(static_cast<HANDLE>(m_FileHandle));
+
+        m_MappingHandle = nullptr;
+        m_FileHandle = nullptr;
+
+        #elif defined(LU_PLATFORM_LINUX) || defined(LU_PLATFORM_MACOS)
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+        #endif
+
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+}
\ No newline at end of file
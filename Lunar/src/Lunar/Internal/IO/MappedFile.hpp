@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <filesystem>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // MappedFile
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: A read-only memory mapping of an entire file, the pages are only read from
+    // disk once they are touched. The data stays valid until Close() or destruction.
+    class MappedFile
+    {
+    public:
+        // Constructors & Destructor
+        MappedFile() = default;
+        MappedFile(const std::filesystem::path& path) { Open(path); }
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator = (const MappedFile&) = delete;
+
+        // Methods
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        // Getters
+        inline bool IsOpen() const { return m_Data != nullptr; }
+
+        inline const uint8_t* GetData() const { return m_Data; }
+        inline size_t GetSize() const { return m_Size; }
+        inline std::span<const uint8_t> GetSpan() const { return { m_Data, m_Size }; }
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+
+        void* m_FileHandle = nullptr;    // Windows only
+        void* m_MappingHandle = nullptr; // Windows only
+    };
+
+}
\ No newline at end of file
@@ -5,12 +5,8 @@
 #include <string>
 #include <string_view>
 #include <format>
-#include <chrono>
-#include <ctime>
 
-#include <iostream>
-#include <iomanip>
-#include <sstream>
+#include "Lunar/Internal/IO/Logger.hpp"
 
 #if defined(LU_PLATFORM_WINDOWS)
     #include <intrin.h>
@@ -94,80 +90,59 @@ namespace Lunar::Internal
         ////////////////////////////////////////////////////////////////////////////////////
         // Print
         ////////////////////////////////////////////////////////////////////////////////////
+        // Note: Everything goes through the Logger, so prints & log messages stay in order
         template <typename... TArgs>
         void Print(std::string_view msg)
         {
-            std::cout << msg << Colour::Reset;
+            Logger::PushRaw(std::string(msg));
         }
 
 		template<typename ...TArgs>
 		void PrintF(std::format_string<TArgs...> fmt, TArgs&&... args)
 		{
-            std::cout << std::format(fmt, std::forward<TArgs>(args)...) << Colour::Reset;
+            Logger::PushRaw(std::format(fmt, std::forward<TArgs>(args)...));
 		}
 
         template<typename... TArgs>
         void PrintLn(std::format_string<TArgs...> fmt, TArgs&&... args)
         {
-            PrintF(fmt, std::forward<TArgs>(args)...);
-            std::cout << '\n';
+            std::string text = std::format(fmt, std::forward<TArgs>(args)...);
+            text += '\n';
+            Logger::PushRaw(std::move(text));
         }
 
         ////////////////////////////////////////////////////////////////////////////////////
         // Levels
         ////////////////////////////////////////////////////////////////////////////////////
-		enum class Level : uint8_t { Trace, Info, Warn, Error, Fatal };
-        
-        template<Level level>
-        inline std::string LevelTag()
+        // Note: Only the message is formatted on the calling thread, the time, tag & colour are added by the sinks
+        template<Level level, typename ...TArgs>
+        void PrintCat(Category category, std::format_string<TArgs...> fmt, TArgs&&... args)
         {
-            if constexpr (level == Level::Trace)
-                return "T";
-            else if constexpr (level == Level::Info)
-                return "I";
-            else if constexpr (level == Level::Warn)
-                return "W";
-            else if constexpr (level == Level::Error)
-                return "E";
-            else if constexpr (level == Level::Fatal)
-                return "F";
-
-            //return "Unset Tag";
+            if (!Logger::IsEnabled(category, level))
+                return;
+
+            Logger::Push(level, std::format(fmt, std::forward<TArgs>(args)...));
         }
 
         template<Level level, typename ...TArgs>
         void PrintLvl(std::format_string<TArgs...> fmt, TArgs&&... args)
         {
-            std::string tag = LevelTag<level>();
-            std::string time;
-            {
-                auto now = std::chrono::system_clock::now();
-                std::time_t nowTime = std::chrono::system_clock::to_time_t(now);
-
-                std::tm localTime = *std::localtime(&nowTime);
-
-                std::ostringstream oss;
-                oss << std::put_time(&localTime, "%H:%M:%S");
-                time = oss.str();
-            }
-
-            std::string message = std::format("[{0}] [{1}]: {2}", time, tag, std::format(fmt, std::forward<TArgs>(args)...));
-
-            // Set colour
-            if constexpr (level == Level::Trace)
-                std::cout << Colour::Reset;
-            else if constexpr (level == Level::Info)
-                std::cout << Colour::GreenFG;
-            else if constexpr (level == Level::Warn)
-                std::cout << Colour::BrightYellowFG;
-            else if constexpr (level == Level::Error)
-                std::cout << Colour::BrightRedFG;
-            else if constexpr (level == Level::Fatal)
-                std::cout << Colour::RedBG;
-            
-            // Simulate PrintLn
-            Print(message);
-            std::cout << '\n';
+            PrintCat<level>(Category::General, fmt, std::forward<TArgs>(args)...);
+        }
+
+        // Note: Suppressed messages are never formatted, only counted
+        template<Level level, typename ...TArgs>
+        void PrintLimited(RateLimiter& limiter, uint64_t key, Category category, std::format_string<TArgs...> fmt, TArgs&&... args)
+        {
+            uint64_t suppressed = 0;
+            if (!Logger::IsEnabled(category, level) || !limiter.Allow(key, suppressed))
+                return;
+
+            std::string message = std::format(fmt, std::forward<TArgs>(args)...);
+            if (suppressed > 0)
+                message += std::format(" (+{0} similar messages suppressed)", suppressed);
+
+            Logger::Push(level, std::move(message));
         }
     };
 
@@ -178,6 +153,18 @@ namespace Lunar::Internal
         #define LU_LOG_ERROR(...)       ::Lunar::Internal::Log::PrintLvl<::Lunar::Internal::Log::Level::Error>(__VA_ARGS__)
         #define LU_LOG_FATAL(...)       ::Lunar::Internal::Log::PrintLvl<::Lunar::Internal::Log::Level::Fatal>(__VA_ARGS__)
 
+        // Note: E.g. LU_LOG_CAT(Warn, Vulkan, "...", ...), the level & category are plain enum names
+        #define LU_LOG_CAT(level, category, ...) ::Lunar::Internal::Log::PrintCat<::Lunar::Internal::Log::Level::level>(::Lunar::Internal::Log::Category::category, __VA_ARGS__)
+
+        // Note: For hot paths, at most one message per second from this call site (or per key)
+        #define LU_LOG_LIMITED(level, category, fmt, ...) LU_LOG_LIMITED_KEY(level, category, 0, fmt __VA_OPT__(,) __VA_ARGS__)
+        #define LU_LOG_LIMITED_KEY(level, category, key, fmt, ...) \
+            do                                                \
+            {                                                 \
+                static ::Lunar::Internal::Log::RateLimiter luRateLimiter(::Lunar::Internal::Log::Level::level, fmt); \
+                ::Lunar::Internal::Log::PrintLimited<::Lunar::Internal::Log::Level::level>(luRateLimiter, static_cast<uint64_t>(key), ::Lunar::Internal::Log::Category::category, fmt __VA_OPT__(,) __VA_ARGS__); \
+            } while (false)
+
         #define LU_ASSERT(x, msg)       \
             do                          \
             {                           \
@@ -204,6 +191,10 @@ namespace Lunar::Internal
         #define LU_LOG_ERROR(...) 
         #define LU_LOG_FATAL(...) 
 
+        #define LU_LOG_CAT(level, category, ...)
+        #define LU_LOG_LIMITED(level, category, fmt, ...)
+        #define LU_LOG_LIMITED_KEY(level, category, key, fmt, ...)
+
         #define LU_ASSERT(x, msg)
         #define LU_VERIFY(x, msg)
     #endif
@@ -0,0 +1,91 @@
+#include "lupch.h"
+#include "Allocator.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+
+#include "Lunar/Internal/Memory/SlabPool.hpp"
+#include "Lunar/Internal/Memory/LinearArena.hpp"
+
+#include <array>
+#include <bit>
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+    namespace
+    {
+        constexpr const size_t PoolCount = std::bit_width(PoolAllocator::MaxSize / PoolAllocator::MinSize);
+
+        static std::array<SlabPool, PoolCount>& GetPools()
+        {
+            static std::array<SlabPool, PoolCount> s_Pools = { SlabPool(16), SlabPool(32), SlabPool(64), SlabPool(128), SlabPool(256), SlabPool(512) };
+            return s_Pools;
+        }
+
+        static size_t GetPoolIndex(size_t size) // Note: Smallest pool that fits
+        {
+            return static_cast<size_t>(std::bit_width((std::max(size, static_cast<size_t>(1)) - 1) / PoolAllocator::MinSize));
+        }
+
+        static LinearArena& GetFrameArena()
+        {
+            static LinearArena s_Arena = {};
+            return s_Arena;
+        }
+
+        #if !defined(LU_CONFIG_DIST)
+        static std::atomic<size_t> s_FrameAllocations = 0;
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // PoolAllocator
+    ////////////////////////////////////////////////////////////////////////////////////
+    void* PoolAllocator::Allocate(size_t size, size_t alignment)
+    {
+        if (size > MaxSize || alignment > SlabPool::Alignment)
+            return HeapAllocator::Allocate(size, alignment);
+
+        return GetPools()[GetPoolIndex(size)].Allocate();
+    }
+
+    void PoolAllocator::Free(void* memory, size_t size, size_t alignment)
+    {
+        if (size > MaxSize || alignment > SlabPool::Alignment)
+            return HeapAllocator::Free(memory, size, alignment);
+
+        GetPools()[GetPoolIndex(size)].Free(memory);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // FrameAllocator
+    ////////////////////////////////////////////////////////////////////////////////////
+    void* FrameAllocator::Allocate(size_t size, size_t alignment)
+    {
+        #if !defined(LU_CONFIG_DIST)
+        s_FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+        #endif
+
+        return GetFrameArena().Allocate(size, alignment);
+    }
+
+    void FrameAllocator::Free(void*, size_t, size_t)
+    {
+        #if !defined(LU_CONFIG_DIST)
+        s_FrameAllocations.fetch_sub(1, std::memory_order_relaxed);
+        #endif
+    }
+
+    void FrameAllocator::Reset()
+    {
+        LU_ASSERT((s_FrameAllocations.load(std::memory_order_relaxed) == 0), "[FrameAllocator] Reset while objects from this frame are still alive.");
+        GetFrameArena().Reset();
+    }
+
+    size_t FrameAllocator::GetUsed()
+    {
+        return GetFrameArena().GetUsed();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <new>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Allocators
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Allocators are stateless types with the following static methods, so they can be
+    // passed as a template argument to Box, Rc & Arc without making the smart pointers any bigger.
+    //  - static void* Allocate(size_t size, size_t alignment);
+    //  - static void Free(void* memory, size_t size, size_t alignment); // Note: With the same size & alignment
+    struct HeapAllocator
+    {
+    public:
+        inline static void* Allocate(size_t size, size_t alignment) { return ::operator new(size, std::align_val_t(alignment)); }
+        inline static void Free(void* memory, size_t, size_t alignment) { ::operator delete(memory, std::align_val_t(alignment)); }
+    };
+
+    // Note: Small allocations (up to MaxSize bytes) come from size classed SlabPools (16, 32, 64, ... bytes),
+    // bigger or overaligned allocations fall back to the HeapAllocator.
+    struct PoolAllocator
+    {
+    public:
+        constexpr static const size_t MinSize = 16;
+        constexpr static const size_t MaxSize = 512;
+    public:
+        static void* Allocate(size_t size, size_t alignment);
+        static void Free(void* memory, size_t size, size_t alignment);
+    };
+
+    // Note: Allocations come from a global LinearArena, Free() doesn't return any memory.
+    // Call Reset() once per frame (e.g. after Renderer::EndFrame) when none of the frame's objects are alive anymore,
+    // destructors still run when the owning Box/Rc/Arc goes out of scope.
+    struct FrameAllocator
+    {
+    public:
+        static void* Allocate(size_t size, size_t alignment);
+        static void Free(void* memory, size_t size, size_t alignment);
+
+        static void Reset();
+
+        static size_t GetUsed();
+    };
+
+}
\ No newline at end of file
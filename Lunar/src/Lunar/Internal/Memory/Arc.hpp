@@ -1,114 +1,116 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <utility>
 #include <atomic>
+#include <new>
+#include <algorithm>
+
+#include "Lunar/Internal/Memory/Allocator.hpp"
+#include "Lunar/Internal/Memory/RefCounted.hpp"
 
 namespace Lunar::Internal
 {
 
+    template<typename T, typename TAllocator = HeapAllocator>
+    class WeakArc;
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Atomic Ref Counting
     ////////////////////////////////////////////////////////////////////////////////////
-    template<typename T>
+    // Note: Create() makes a single allocation (through TAllocator), the count sits right in front of the object.
+    // Arc only stores the object pointer, dereferencing only checks the destroyed flag next to it (never the count).
+    // Types deriving from RefCounted keep the count inside the object instead.
+    // Note 2: Increments are relaxed, a new reference can only be made from an existing one.
+    // Decrements release & the last one acquires, so all writes to the object happen before it's destroyed.
+    template<typename T, typename TAllocator = HeapAllocator>
     class Arc
     {
     private:
-        struct Block
+        struct Header
         {
         public:
-            T* Object;
-            std::atomic<uint32_t> RefCount;
+            std::atomic<uint32_t> RefCount = 1;
+            std::atomic<uint32_t> WeakCount = 1; // Note: All strong references together hold one weak reference
+            std::atomic<bool> Destroyed = false; // Note: Set by whoever destroys the object, Reset() or the last reference
+
+            void (*DestroyObject)(void* object) = nullptr;
+            void (*Free)(void* object) = nullptr;
+        };
 
+        template<typename TObject>
+        struct Layout
+        {
         public:
-            Block(uint32_t refCount, T* object) 
-                : RefCount(refCount), Object(object) 
-            {
-            }
+            constexpr static const size_t Alignment = std::max(alignof(TObject), alignof(Header));
+            constexpr static const size_t Offset = ((sizeof(Header) + alignof(TObject) - 1) / alignof(TObject)) * alignof(TObject); // Note: Of the object
+            constexpr static const size_t Size = Offset + sizeof(TObject);
         };
 
+        constexpr static const bool Intrusive = IsRefCounted<T>;
+
     private:
         // Constructors & Destructor
-        template <typename... TArgs>
-        explicit Arc(Block* block) 
-            : m_Memory(block)
+        explicit Arc(T* object) 
+            : m_Object(object)
         {
         }
 
     public:
         Arc() 
-            : m_Memory(nullptr) 
+            : m_Object(nullptr) 
         {
         }
 
         Arc(std::nullptr_t) 
-            : m_Memory(nullptr)
+            : m_Object(nullptr)
         {
         }
 
         ~Arc()
         {
-            if (m_Memory && --m_Memory->RefCount == 0) 
-            {
-                if (m_Memory->Object)
-                    delete m_Memory->Object;
-
-                delete m_Memory;
-            }
+            Release();
         }
 
         // Moving
         Arc(Arc&& other) noexcept 
-            : m_Memory(other.m_Memory) 
+            : m_Object(other.m_Object) 
         { 
-            other.m_Memory = nullptr; 
+            other.m_Object = nullptr; 
         }
 
         Arc& operator = (Arc&& other) noexcept
         {
             if (this != &other) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
+                Release();
 
-                // Set new objects
-                m_Memory = other.m_Memory;
-                other.m_Memory = nullptr;
+                m_Object = other.m_Object;
+                other.m_Object = nullptr;
             }
 
             return *this;
         }
 
         template <typename T2>
-        Arc(Arc<T2>&& other) noexcept 
-            : m_Memory(reinterpret_cast<Block*>(other.m_Memory))
+        Arc(Arc<T2, TAllocator>&& other) noexcept 
+            : m_Object(reinterpret_cast<T*>(other.m_Object))
         {
-            other.m_Memory = nullptr;
+            static_assert((Arc<T2, TAllocator>::Intrusive == Intrusive), "[Arc] Can't convert between RefCounted & non-RefCounted types.");
+            other.m_Object = nullptr;
         }
 
         template <typename T2>
-        Arc& operator = (Arc<T2>&& other) noexcept
+        Arc& operator = (Arc<T2, TAllocator>&& other) noexcept
         {
-            if (this != &other) 
+            static_assert((Arc<T2, TAllocator>::Intrusive == Intrusive), "[Arc] Can't convert between RefCounted & non-RefCounted types.");
+            if (static_cast<void*>(this) != static_cast<void*>(&other)) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
+                Release();
 
-                    delete m_Memory;
-                }
-
-                // Set new objects
-                m_Memory = reinterpret_cast<Block*>(other.m_Memory);
-                other.m_Memory = nullptr;
+                m_Object = reinterpret_cast<T*>(other.m_Object);
+                other.m_Object = nullptr;
             }
 
             return *this;
@@ -116,83 +118,45 @@ namespace Lunar::Internal
 
         // Copying
         Arc(const Arc& other) 
-            : m_Memory(nullptr)
+            : m_Object(other.m_Object)
         {
-            if (this != &other) 
-            {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
-
-                // Set new objects & increase reference count
-                m_Memory = other.m_Memory;
-                if (m_Memory) 
-                {
-                    m_Memory->RefCount++;
-                }
-            }
+            Retain();
         }
 
         Arc& operator = (const Arc& other)
         {
-            if (this != &other) 
+            if (m_Object != other.m_Object) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
+                Release();
 
-                // Set new objects & increase reference count
-                m_Memory = other.m_Memory;
-                if (m_Memory) 
-                {
-                    m_Memory->RefCount++;
-                }
+                m_Object = other.m_Object;
+                Retain();
             }
 
             return *this;
         }
 
         template <typename T2>
-        Arc(const Arc<T2>& other) 
-            : m_Memory(reinterpret_cast<Block*>(other.m_Memory))
+        Arc(const Arc<T2, TAllocator>& other) 
+            : m_Object(reinterpret_cast<T*>(other.m_Object))
         {
-            if (m_Memory) 
-            {
-                m_Memory->RefCount++;
-            }
+            static_assert((Arc<T2, TAllocator>::Intrusive == Intrusive), "[Arc] Can't convert between RefCounted & non-RefCounted types.");
+            Retain();
         }
 
         template <typename T2>
-        Arc operator = (const Arc<T2>& other)
+        Arc& operator = (const Arc<T2, TAllocator>& other)
         {
-            if (this != &other) 
+            static_assert((Arc<T2, TAllocator>::Intrusive == Intrusive), "[Arc] Can't convert between RefCounted & non-RefCounted types.");
+            if (static_cast<void*>(m_Object) != static_cast<void*>(other.m_Object)) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
+                Release();
 
-                // Set new objects & increase reference count
-                m_Memory = reinterpret_cast<Block*>(other.m_Memory);
-                if (m_Memory) 
-                {
-                    m_Memory->RefCount++;
-                }
+                m_Object = reinterpret_cast<T*>(other.m_Object);
+                Retain();
             }
+
+            return *this;
         }
 
         Arc Clone() 
@@ -207,95 +171,321 @@ namespace Lunar::Internal
         inline T& operator * () { return *Raw(); }
         inline const T& operator * () const { return *Raw(); }
 
-        inline operator bool() const { return m_Memory != nullptr; }
+        inline operator bool() const { return Raw() != nullptr; }
 
-        inline bool operator == (std::nullptr_t) { return m_Memory == nullptr; }
+        inline bool operator == (std::nullptr_t) { return Raw() == nullptr; }
         inline bool operator != (std::nullptr_t n) { return !(*this == n); }
 
         // Methods
-        inline uint32_t RefCount() const { return m_Memory ? m_Memory->RefCount.load(std::memory_order_acquire) : 0; }
+        inline uint32_t RefCount() const 
+        { 
+            if (!m_Object)
+                return 0;
 
-        inline void Reset() // Note: Make sure what you're doing when you call this.
+            if constexpr (Intrusive)
+                return m_Object->GetRefCount();
+            else
+                return GetHeader()->RefCount.load(std::memory_order_relaxed);
+        }
+
+        // Note: Make sure what you're doing when you call this.
+        // Destroys the object for every reference, afterwards Raw() returns nullptr & WeakArc::Lock() fails everywhere.
+        // The memory itself is freed once the last reference is gone.
+        inline void Reset()
+        {
+            static_assert(!Intrusive, "[Arc] Reset() isn't available for RefCounted types, since the count lives inside the object.");
+            if (m_Object && !GetHeader()->Destroyed.exchange(true, std::memory_order_acq_rel))
+                GetHeader()->DestroyObject(m_Object);
+        }
+
+        inline T* Raw() { return (IsAlive() ? m_Object : nullptr); }
+        inline const T* Raw() const { return (IsAlive() ? m_Object : nullptr); }
+
+        template <typename T2>
+        inline T2* RawAs() { return reinterpret_cast<T2*>(Raw()); }
+
+        template <typename T2>
+        inline const T2* RawAs() const { return reinterpret_cast<const T2*>(Raw()); }
+
+        template <typename T2>
+        inline Arc<T2, TAllocator> As()
         {
-            if (m_Memory && m_Memory->Object)
+            return Arc<T2, TAllocator>(*this);
+        }
+
+        template <typename T2>
+        inline const Arc<T2, TAllocator> As() const
+        {
+            return Arc<T2, TAllocator>(*this);
+        }
+
+        // Static methods
+        template <typename... TArgs>
+        static Arc Create(TArgs&&... args)
+        {
+            return Arc(Allocate<T>(std::forward<TArgs>(args)...));
+        }
+
+        template <typename T2, typename... TArgs>
+        static Arc Create(TArgs&&... args)
+        {
+            return Arc(reinterpret_cast<T*>(Allocate<T2>(std::forward<TArgs>(args)...)));
+        }
+
+    private:
+        // Private methods
+        inline Header* GetHeader() const
+        {
+            return GetHeader(m_Object);
+        }
+
+        inline static Header* GetHeader(const T* object)
+        {
+            return reinterpret_cast<Header*>(reinterpret_cast<std::byte*>(const_cast<std::remove_const_t<T>*>(object)) - sizeof(Header));
+        }
+
+        inline bool IsAlive() const
+        {
+            if (!m_Object)
+                return false;
+
+            if constexpr (Intrusive)
+                return true;
+            else
+                return !GetHeader()->Destroyed.load(std::memory_order_acquire);
+        }
+
+        inline void Retain()
+        {
+            if (!m_Object)
+                return;
+
+            if constexpr (Intrusive)
+                static_cast<const RefCounted*>(m_Object)->m_RefCount.fetch_add(1, std::memory_order_relaxed);
+            else
+                GetHeader()->RefCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline void Release()
+        {
+            if (!m_Object)
+                return;
+
+            if constexpr (Intrusive)
             {
-                delete m_Memory->Object;
-                m_Memory->Object = nullptr;
+                if (static_cast<const RefCounted*>(m_Object)->m_RefCount.fetch_sub(1, std::memory_order_release) == 1)
+                {
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    delete static_cast<const RefCounted*>(m_Object);
+                }
+            }
+            else
+            {
+                Header* header = GetHeader();
+                if (header->RefCount.fetch_sub(1, std::memory_order_release) == 1)
+                {
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (!header->Destroyed.exchange(true, std::memory_order_acq_rel))
+                        header->DestroyObject(m_Object);
+
+                    ReleaseWeak(m_Object);
+                }
             }
+
+            m_Object = nullptr;
         }
 
-        inline T* Raw()
+        inline static void ReleaseWeak(T* object)
         {
-            if (m_Memory) 
+            Header* header = GetHeader(object);
+            if (header->WeakCount.fetch_sub(1, std::memory_order_release) == 1)
             {
-                return m_Memory->Object;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                header->Free(object);
             }
+        }
 
-            return nullptr;
+        template <typename TObject, typename... TArgs>
+        static TObject* Allocate(TArgs&&... args)
+        {
+            if constexpr (Intrusive)
+            {
+                static_assert(IsRefCounted<TObject>, "[Arc] Objects created through an Arc of a RefCounted type have to be RefCounted.");
+                static_assert(std::is_same_v<TAllocator, HeapAllocator>, "[Arc] RefCounted types only support the HeapAllocator.");
+
+                TObject* object = new TObject(std::forward<TArgs>(args)...);
+                static_cast<const RefCounted*>(object)->m_RefCount = 1;
+                return object;
+            }
+            else
+            {
+                using ObjectLayout = Layout<TObject>;
+
+                std::byte* memory = static_cast<std::byte*>(TAllocator::Allocate(ObjectLayout::Size, ObjectLayout::Alignment));
+                Header* header = new (memory + ObjectLayout::Offset - sizeof(Header)) Header();
+                header->DestroyObject = [](void* object) { static_cast<TObject*>(object)->~TObject(); };
+                header->Free = [](void* object) { TAllocator::Free(static_cast<std::byte*>(object) - ObjectLayout::Offset, ObjectLayout::Size, ObjectLayout::Alignment); };
+
+                return new (memory + ObjectLayout::Offset) TObject(std::forward<TArgs>(args)...);
+            }
         }
 
-        inline const T* Raw() const
+    private:
+        T* m_Object;
+
+        template <typename T2, typename TAllocator2>
+        friend class Arc;
+        template <typename T2, typename TAllocator2>
+        friend class WeakArc;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Weak Atomic Ref Counting
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Doesn't keep the object alive, only its memory. Use Lock() to get a strong reference,
+    // which is null once the object has been destroyed (by the last reference or Arc::Reset()). Useful for caches that shouldn't own their entries.
+    // Note 2: Not available for RefCounted types, since their count is destroyed together with the object.
+    template<typename T, typename TAllocator>
+    class WeakArc
+    {
+    private:
+        using Header = typename Arc<T, TAllocator>::Header;
+
+        static_assert(!Arc<T, TAllocator>::Intrusive, "[WeakArc] WeakArc isn't available for RefCounted types.");
+
+    public:
+        // Constructors & Destructor
+        WeakArc() 
+            : m_Object(nullptr) 
+        {
+        }
+
+        WeakArc(std::nullptr_t) 
+            : m_Object(nullptr)
         {
-            if (m_Memory) 
+        }
+
+        WeakArc(const Arc<T, TAllocator>& arc) 
+            : m_Object(arc.m_Object)
+        {
+            Retain();
+        }
+
+        ~WeakArc()
+        {
+            Release();
+        }
+
+        // Moving
+        WeakArc(WeakArc&& other) noexcept 
+            : m_Object(other.m_Object) 
+        { 
+            other.m_Object = nullptr; 
+        }
+
+        WeakArc& operator = (WeakArc&& other) noexcept
+        {
+            if (this != &other) 
             {
-                return m_Memory->Object;
+                Release();
+
+                m_Object = other.m_Object;
+                other.m_Object = nullptr;
             }
 
-            return nullptr;
+            return *this;
         }
 
-        template <typename T2>
-        inline T2* RawAs()
+        // Copying
+        WeakArc(const WeakArc& other) 
+            : m_Object(other.m_Object)
+        {
+            Retain();
+        }
+
+        WeakArc& operator = (const WeakArc& other)
         {
-            if (m_Memory) 
+            if (m_Object != other.m_Object) 
             {
-                return reinterpret_cast<T2*>(m_Memory->Object);
+                Release();
+
+                m_Object = other.m_Object;
+                Retain();
             }
 
-            return nullptr;
+            return *this;
         }
 
-        template <typename T2>
-        inline const T2* RawAs() const
+        WeakArc& operator = (const Arc<T, TAllocator>& arc)
         {
-            if (m_Memory) 
+            if (m_Object != arc.m_Object) 
             {
-                return reinterpret_cast<T2*>(m_Memory->Object);
+                Release();
+
+                m_Object = arc.m_Object;
+                Retain();
             }
 
-            return nullptr;
+            return *this;
         }
 
-        template <typename T2>
-        inline Arc<T2> As()
+        WeakArc& operator = (std::nullptr_t)
         {
-            return Arc<T2>(*this);
+            Release();
+            return *this;
         }
 
-        template <typename T2>
-        inline const Arc<T2> As() const
+        // Operators
+        inline bool operator == (std::nullptr_t) { return m_Object == nullptr; }
+        inline bool operator != (std::nullptr_t n) { return !(*this == n); }
+
+        // Methods
+        inline Arc<T, TAllocator> Lock() const
         {
-            return Arc<T2>(*this);
+            if (!m_Object)
+                return nullptr;
+
+            // Note: Only take a strong reference if there's still one left, otherwise the object is (being) destroyed
+            Header* header = Arc<T, TAllocator>::GetHeader(m_Object);
+            uint32_t count = header->RefCount.load(std::memory_order_relaxed);
+            while (count != 0)
+            {
+                if (header->RefCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    // Note: The object may have been Reset() while references remain, our reference is dropped again on return
+                    Arc<T, TAllocator> arc(m_Object);
+                    if (header->Destroyed.load(std::memory_order_acquire))
+                        return nullptr;
+
+                    return arc;
+                }
+            }
+
+            return nullptr;
         }
 
-        // Static methods
-        template <typename... TArgs>
-        static Arc Create(TArgs&&... args)
+        inline bool Expired() const { return (RefCount() == 0) || Arc<T, TAllocator>::GetHeader(m_Object)->Destroyed.load(std::memory_order_acquire); }
+        inline uint32_t RefCount() const { return m_Object ? Arc<T, TAllocator>::GetHeader(m_Object)->RefCount.load(std::memory_order_relaxed) : 0; } // Note: Of the strong references
+
+    private:
+        // Private methods
+        inline void Retain()
         {
-            return Arc(new Block(1, new T(std::forward<TArgs>(args)...)));
+            if (m_Object)
+                Arc<T, TAllocator>::GetHeader(m_Object)->WeakCount.fetch_add(1, std::memory_order_relaxed);
         }
 
-        template <typename T2, typename... TArgs>
-        static Arc Create(TArgs&&... args)
+        inline void Release()
         {
-            return Arc(new Block(1, reinterpret_cast<T*>((new T2(std::forward<TArgs>(args)...)))));
+            if (!m_Object)
+                return;
+
+            Arc<T, TAllocator>::ReleaseWeak(m_Object);
+            m_Object = nullptr;
         }
 
     private:
-        Block* m_Memory;
-
-        template <typename T2>
-        friend class Arc;
+        T* m_Object;
     };
 
 }
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <memory>
 #include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "Lunar/Internal/Memory/Allocator.hpp"
 
 namespace Lunar::Internal
 {
@@ -10,9 +15,30 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
 	// Unique (heap) Ownership
     ////////////////////////////////////////////////////////////////////////////////////
-	template<typename T>
+	// Note: With any allocator other than the HeapAllocator, Create() places a small header in front
+	// of the object that knows how to destroy & free it, so a Box<Base> can still free a Derived.
+	// Conversions between types must not adjust the pointer (e.g. multiple inheritance) in that case.
+	template<typename T, typename TAllocator = HeapAllocator>
 	class Box
 	{
+	private:
+		struct Header
+		{
+		public:
+			void (*Destroy)(void* object) = nullptr;
+		};
+
+		template<typename TObject>
+		struct Layout
+		{
+		public:
+			constexpr static const size_t Alignment = std::max(alignof(TObject), alignof(Header));
+			constexpr static const size_t Offset = ((sizeof(Header) + alignof(TObject) - 1) / alignof(TObject)) * alignof(TObject); // Note: Of the object
+			constexpr static const size_t Size = Offset + sizeof(TObject);
+		};
+
+		constexpr static const bool Heap = std::is_same_v<TAllocator, HeapAllocator>;
+
 	public:
 		// Construtors & Destructor
 		Box()
@@ -28,20 +54,19 @@ namespace Lunar::Internal
 		explicit Box(T* obj)
 			: m_Object(obj)
 		{
+			static_assert(Heap, "[Box] Only a Box with the HeapAllocator can take ownership of a raw pointer.");
 		}
 
 		template<typename T2>
 		explicit Box(T2* obj)
 			: m_Object(static_cast<T*>(obj))
 		{
+			static_assert(Heap, "[Box] Only a Box with the HeapAllocator can take ownership of a raw pointer.");
 		}
 
 		~Box()
 		{
-			if (m_Object)
-			{
-				delete m_Object;
-			}
+			Reset();
 		}
 
 		// Moving
@@ -55,6 +80,8 @@ namespace Lunar::Internal
 		{
 			if (this != &other)
 			{
+				Reset();
+
 				m_Object = other.m_Object;
 				other.m_Object = nullptr;
 			}
@@ -63,17 +90,19 @@ namespace Lunar::Internal
 		}
 
 		template<typename T2>
-		Box(Box<T2>&& other) noexcept
+		Box(Box<T2, TAllocator>&& other) noexcept
 			: m_Object(static_cast<T*>(other.m_Object))
 		{
 			other.m_Object = nullptr;
 		}
 
 		template<typename T2>
-		Box& operator = (Box<T2>&& other) noexcept
+		Box& operator = (Box<T2, TAllocator>&& other) noexcept
 		{
             if (static_cast<void*>(this) != static_cast<void*>(&other))
 			{
+				Reset();
+
 				m_Object = static_cast<T*>(other.m_Object);
 				other.m_Object = nullptr;
 			}
@@ -102,7 +131,10 @@ namespace Lunar::Internal
 		{ 
 			if (m_Object) 
 			{
-                delete m_Object;
+				if constexpr (Heap)
+					delete m_Object;
+				else
+					GetHeader()->Destroy(m_Object);
             }
 
 			m_Object = nullptr;
@@ -134,19 +166,46 @@ namespace Lunar::Internal
 		template<typename ...TArgs>
 		static Box Create(TArgs&& ...args)
 		{
-			return Box(new T(std::forward<TArgs>(args)...));
+			return Create<T>(std::forward<TArgs>(args)...);
 		}
 
 		template<typename T2, typename ...TArgs>
 		static Box Create(TArgs&& ...args)
 		{
-			return Box<T>(new T2(std::forward<TArgs>(args)...));
+			Box box;
+			if constexpr (Heap)
+			{
+				box.m_Object = static_cast<T*>(new T2(std::forward<TArgs>(args)...));
+			}
+			else
+			{
+				using ObjectLayout = Layout<T2>;
+
+				std::byte* memory = static_cast<std::byte*>(TAllocator::Allocate(ObjectLayout::Size, ObjectLayout::Alignment));
+				Header* header = new (memory + ObjectLayout::Offset - sizeof(Header)) Header();
+				header->Destroy = [](void* object) 
+				{ 
+					static_cast<T2*>(object)->~T2(); 
+					TAllocator::Free(static_cast<std::byte*>(object) - ObjectLayout::Offset, ObjectLayout::Size, ObjectLayout::Alignment);
+				};
+
+				box.m_Object = static_cast<T*>(new (memory + ObjectLayout::Offset) T2(std::forward<TArgs>(args)...));
+			}
+
+			return box;
+		}
+
+	private:
+		// Private methods
+		inline Header* GetHeader() const
+		{
+			return reinterpret_cast<Header*>(reinterpret_cast<std::byte*>(const_cast<std::remove_const_t<T>*>(m_Object)) - sizeof(Header));
 		}
 
 	private:
 		T* m_Object;
 
-		template<typename T2>
+		template<typename T2, typename TAllocator2>
 		friend class Box;
 	};
 
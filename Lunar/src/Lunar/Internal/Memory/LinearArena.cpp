@@ -0,0 +1,117 @@
+#include "lupch.h"
+#include "LinearArena.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include <new>
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    LinearArena::LinearArena(size_t chunkSize)
+        : m_ChunkSize(chunkSize)
+    {
+        m_Chunks.push_back(AllocateChunk(m_ChunkSize));
+        m_Current.store(m_Chunks.back(), std::memory_order_release);
+    }
+
+    LinearArena::~LinearArena()
+    {
+        for (Chunk* chunk : m_Chunks)
+            FreeChunk(chunk);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void* LinearArena::Allocate(size_t size, size_t alignment)
+    {
+        LU_ASSERT(((alignment & (alignment - 1)) == 0), "[LinearArena] Alignment has to be a power of 2.");
+
+        while (true)
+        {
+            Chunk* chunk = m_Current.load(std::memory_order_acquire);
+
+            // Note: Aligned on the address, so any alignment works as long as the padding fits
+            const uintptr_t base = reinterpret_cast<uintptr_t>(chunk->Memory);
+            size_t offset = chunk->Offset.load(std::memory_order_relaxed);
+            while (true)
+            {
+                const size_t aligned = static_cast<size_t>(((base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base);
+                if (aligned + size > chunk->Size)
+                    break;
+
+                if (chunk->Offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed))
+                    return chunk->Memory + aligned;
+            }
+
+            // The chunk is full, add a new one (unless another thread already did)
+            std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+            if (m_Current.load(std::memory_order_relaxed) == chunk)
+            {
+                m_Chunks.push_back(AllocateChunk(std::max(m_ChunkSize, size + alignment)));
+                m_Current.store(m_Chunks.back(), std::memory_order_release);
+            }
+        }
+    }
+
+    void LinearArena::Reset()
+    {
+        LU_PROFILE("LinearArena::Reset()");
+
+        // Merge all chunks into one that fits everything the last cycle needed
+        if (m_Chunks.size() > 1)
+        {
+            const size_t capacity = m_Capacity;
+            for (Chunk* chunk : m_Chunks)
+                FreeChunk(chunk);
+
+            m_Chunks.clear();
+            m_Chunks.push_back(AllocateChunk(capacity));
+            m_Current.store(m_Chunks.back(), std::memory_order_release);
+        }
+
+        m_Chunks.back()->Offset.store(0, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t LinearArena::GetUsed() const
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        size_t used = 0;
+        for (const Chunk* chunk : m_Chunks)
+            used += std::min(chunk->Offset.load(std::memory_order_relaxed), chunk->Size);
+
+        return used;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    LinearArena::Chunk* LinearArena::AllocateChunk(size_t size)
+    {
+        Chunk* chunk = new Chunk();
+        chunk->Memory = static_cast<std::byte*>(::operator new(size, std::align_val_t(alignof(std::max_align_t))));
+        chunk->Size = size;
+
+        m_Capacity += size;
+        return chunk;
+    }
+
+    void LinearArena::FreeChunk(Chunk* chunk)
+    {
+        m_Capacity -= chunk->Size;
+
+        ::operator delete(chunk->Memory, std::align_val_t(alignof(std::max_align_t)));
+        delete chunk;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // LinearArena
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: A bump allocator, individual allocations are never freed, Reset() releases everything at once.
+    // Allocating is a single CAS on the current chunk, only growing takes a lock.
+    // After a Reset() the chunks are merged into one, so a steady workload ends up with a single chunk.
+    class LinearArena
+    {
+    public:
+        constexpr static const size_t DefaultChunkSize = 64ull * 1024ull;
+    public:
+        // Constructor & Destructor
+        LinearArena(size_t chunkSize = DefaultChunkSize);
+        ~LinearArena();
+
+        // Methods
+        void* Allocate(size_t size, size_t alignment);
+        void Reset(); // Note: Not thread safe, nothing may allocate from the arena while it's being reset
+
+        // Getters
+        size_t GetUsed() const; // Note: In bytes, including alignment padding
+        inline size_t GetCapacity() const { return m_Capacity; }
+
+    private:
+        struct Chunk
+        {
+        public:
+            std::byte* Memory = nullptr;
+            size_t Size = 0;
+
+            std::atomic<size_t> Offset = 0;
+        };
+
+    private:
+        // Private methods
+        Chunk* AllocateChunk(size_t size);
+        void FreeChunk(Chunk* chunk);
+
+    private:
+        size_t m_ChunkSize;
+        size_t m_Capacity = 0;
+
+        std::atomic<Chunk*> m_Current = nullptr;
+
+        mutable std::mutex m_ThreadSafety = {};
+        std::vector<Chunk*> m_Chunks = { };
+    };
+
+}
\ No newline at end of file
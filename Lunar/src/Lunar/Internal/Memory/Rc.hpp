@@ -1,114 +1,108 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <utility>
-#include <atomic>
+#include <new>
+#include <algorithm>
+
+#include "Lunar/Internal/Memory/Allocator.hpp"
+#include "Lunar/Internal/Memory/RefCounted.hpp"
 
 namespace Lunar::Internal
 {
 
     ////////////////////////////////////////////////////////////////////////////////////
-    // Atomic Ref Counting
+    // Ref Counting
     ////////////////////////////////////////////////////////////////////////////////////
-    template<typename T>
+    // Note: Create() makes a single allocation (through TAllocator), the count sits right in front of the object.
+    // Rc only stores the object pointer, so dereferencing never touches the count.
+    // Types deriving from RefCounted keep the count inside the object instead.
+    template<typename T, typename TAllocator = HeapAllocator>
     class Rc
     {
     private:
-        struct Block
+        struct Header
         {
         public:
-            T* Object;
-            uint32_t RefCount;
+            uint32_t RefCount = 1;
+
+            void (*DestroyObject)(void* object) = nullptr;
+            void (*Free)(void* object) = nullptr;
+        };
 
+        template<typename TObject>
+        struct Layout
+        {
         public:
-            Block(uint32_t refCount, T* object) 
-                : RefCount(refCount), Object(object) 
-            {
-            }
+            constexpr static const size_t Alignment = std::max(alignof(TObject), alignof(Header));
+            constexpr static const size_t Offset = ((sizeof(Header) + alignof(TObject) - 1) / alignof(TObject)) * alignof(TObject); // Note: Of the object
+            constexpr static const size_t Size = Offset + sizeof(TObject);
         };
 
+        constexpr static const bool Intrusive = IsRefCounted<T>;
+
     private:
         // Constructors & Destructor
-        template <typename... TArgs>
-        explicit Rc(Block* block) 
-            : m_Memory(block)
+        explicit Rc(T* object) 
+            : m_Object(object)
         {
         }
 
     public:
         Rc() 
-            : m_Memory(nullptr) 
+            : m_Object(nullptr) 
         {
         }
 
         Rc(std::nullptr_t) 
-            : m_Memory(nullptr)
+            : m_Object(nullptr)
         {
         }
 
         ~Rc()
         {
-            if (m_Memory && --m_Memory->RefCount == 0) 
-            {
-                if (m_Memory->Object)
-                    delete m_Memory->Object;
-
-                delete m_Memory;
-            }
+            Release();
         }
 
         // Moving
         Rc(Rc&& other) noexcept 
-            : m_Memory(other.m_Memory) 
+            : m_Object(other.m_Object) 
         { 
-            other.m_Memory = nullptr; 
+            other.m_Object = nullptr; 
         }
 
         Rc& operator = (Rc&& other) noexcept
         {
             if (this != &other) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
+                Release();
 
-                    delete m_Memory;
-                }
-
-                // Set new objects
-                m_Memory = other.m_Memory;
-                other.m_Memory = nullptr;
+                m_Object = other.m_Object;
+                other.m_Object = nullptr;
             }
 
             return *this;
         }
 
         template <typename T2>
-        Rc(Rc<T2>&& other) noexcept 
-            : m_Memory(reinterpret_cast<Block*>(other.m_Memory))
+        Rc(Rc<T2, TAllocator>&& other) noexcept 
+            : m_Object(reinterpret_cast<T*>(other.m_Object))
         {
-            other.m_Memory = nullptr;
+            static_assert((Rc<T2, TAllocator>::Intrusive == Intrusive), "[Rc] Can't convert between RefCounted & non-RefCounted types.");
+            other.m_Object = nullptr;
         }
 
         template <typename T2>
-        Rc& operator = (Rc<T2>&& other) noexcept
+        Rc& operator = (Rc<T2, TAllocator>&& other) noexcept
         {
-            if (this != &other) 
+            static_assert((Rc<T2, TAllocator>::Intrusive == Intrusive), "[Rc] Can't convert between RefCounted & non-RefCounted types.");
+            if (static_cast<void*>(this) != static_cast<void*>(&other)) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
+                Release();
 
-                // Set new objects
-                m_Memory = reinterpret_cast<Block*>(other.m_Memory);
-                other.m_Memory = nullptr;
+                m_Object = reinterpret_cast<T*>(other.m_Object);
+                other.m_Object = nullptr;
             }
 
             return *this;
@@ -116,83 +110,45 @@ namespace Lunar::Internal
 
         // Copying
         Rc(const Rc& other) 
-            : m_Memory(nullptr)
+            : m_Object(other.m_Object)
         {
-            if (this != &other) 
-            {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
-
-                // Set new objects & increase reference count
-                m_Memory = other.m_Memory;
-                if (m_Memory) 
-                {
-                    m_Memory->RefCount++;
-                }
-            }
+            Retain();
         }
 
         Rc& operator = (const Rc& other)
         {
-            if (this != &other) 
+            if (m_Object != other.m_Object) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
+                Release();
 
-                // Set new objects & increase reference count
-                m_Memory = other.m_Memory;
-                if (m_Memory) 
-                {
-                    m_Memory->RefCount++;
-                }
+                m_Object = other.m_Object;
+                Retain();
             }
 
             return *this;
         }
 
         template <typename T2>
-        Rc(const Rc<T2>& other) 
-            : m_Memory(reinterpret_cast<Block*>(other.m_Memory))
+        Rc(const Rc<T2, TAllocator>& other) 
+            : m_Object(reinterpret_cast<T*>(other.m_Object))
         {
-            if (m_Memory) 
-            {
-                m_Memory->RefCount++;
-            }
+            static_assert((Rc<T2, TAllocator>::Intrusive == Intrusive), "[Rc] Can't convert between RefCounted & non-RefCounted types.");
+            Retain();
         }
 
         template <typename T2>
-        Rc operator = (const Rc<T2>& other)
+        Rc& operator = (const Rc<T2, TAllocator>& other)
         {
-            if (this != &other) 
+            static_assert((Rc<T2, TAllocator>::Intrusive == Intrusive), "[Rc] Can't convert between RefCounted & non-RefCounted types.");
+            if (static_cast<void*>(m_Object) != static_cast<void*>(other.m_Object)) 
             {
-                // Remove a reference from current object
-                if (m_Memory && --m_Memory->RefCount == 0) 
-                {
-                    if (m_Memory->Object)
-                        delete m_Memory->Object;
-
-                    delete m_Memory;
-                }
+                Release();
 
-                // Set new objects & increase reference count
-                m_Memory = reinterpret_cast<Block*>(other.m_Memory);
-                if (m_Memory) 
-                {
-                    m_Memory->RefCount++;
-                }
+                m_Object = reinterpret_cast<T*>(other.m_Object);
+                Retain();
             }
+
+            return *this;
         }
 
         Rc Clone() 
@@ -207,85 +163,128 @@ namespace Lunar::Internal
         inline T& operator * () { return *Raw(); }
         inline const T& operator * () const { return *Raw(); }
 
-        inline operator bool() const { return m_Memory != nullptr; }
+        inline operator bool() const { return m_Object != nullptr; }
 
-        inline bool operator == (std::nullptr_t) { return m_Memory == nullptr; }
+        inline bool operator == (std::nullptr_t) { return m_Object == nullptr; }
         inline bool operator != (std::nullptr_t n) { return !(*this == n); }
 
         // Methods
-        inline uint32_t RefCount() const { return m_Memory ? m_Memory->RefCount.load(std::memory_order_acquire) : 0; }
-
-        inline T* Raw()
-        {
-            if (m_Memory) 
-            {
-                return m_Memory->Object;
-            }
+        inline uint32_t RefCount() const 
+        { 
+            if (!m_Object)
+                return 0;
 
-            return nullptr;
+            if constexpr (Intrusive)
+                return m_Object->GetRefCount();
+            else
+                return GetHeader()->RefCount;
         }
 
-        inline const T* Raw() const
-        {
-            if (m_Memory) 
-            {
-                return m_Memory->Object;
-            }
-
-            return nullptr;
-        }
+        inline T* Raw() { return m_Object; }
+        inline const T* Raw() const { return m_Object; }
 
         template <typename T2>
-        inline T2* RawAs()
-        {
-            if (m_Memory) 
-            {
-                return reinterpret_cast<T2*>(m_Memory->Object);
-            }
-
-            return nullptr;
-        }
+        inline T2* RawAs() { return reinterpret_cast<T2*>(m_Object); }
 
         template <typename T2>
-        inline const T2* RawAs() const
-        {
-            if (m_Memory) 
-            {
-                return reinterpret_cast<T2*>(m_Memory->Object);
-            }
-
-            return nullptr;
-        }
+        inline const T2* RawAs() const { return reinterpret_cast<const T2*>(m_Object); }
 
         template <typename T2>
-        inline Rc<T2> As()
+        inline Rc<T2, TAllocator> As()
         {
-            return Rc<T2>(*this);
+            return Rc<T2, TAllocator>(*this);
         }
 
         template <typename T2>
-        inline const Rc<T2> As() const
+        inline const Rc<T2, TAllocator> As() const
         {
-            return Rc<T2>(*this);
+            return Rc<T2, TAllocator>(*this);
         }
 
         // Static methods
         template <typename... TArgs>
         static Rc Create(TArgs&&... args)
         {
-            return Rc(new Block(1, new T(std::forward<TArgs>(args)...)));
+            return Rc(Allocate<T>(std::forward<TArgs>(args)...));
         }
 
         template <typename T2, typename... TArgs>
         static Rc Create(TArgs&&... args)
         {
-            return Rc(new Block(1, reinterpret_cast<T*>((new T2(std::forward<TArgs>(args)...)))));
+            return Rc(reinterpret_cast<T*>(Allocate<T2>(std::forward<TArgs>(args)...)));
         }
 
     private:
-        Block* m_Memory;
+        // Private methods
+        inline Header* GetHeader() const
+        {
+            return reinterpret_cast<Header*>(reinterpret_cast<std::byte*>(const_cast<std::remove_const_t<T>*>(m_Object)) - sizeof(Header));
+        }
 
-        template <typename T2>
+        inline void Retain()
+        {
+            if (!m_Object)
+                return;
+
+            if constexpr (Intrusive)
+                static_cast<const RefCounted*>(m_Object)->m_RefCount.fetch_add(1, std::memory_order_relaxed); // Note: Rc is never shared between threads
+            else
+                GetHeader()->RefCount++;
+        }
+
+        inline void Release()
+        {
+            if (!m_Object)
+                return;
+
+            if constexpr (Intrusive)
+            {
+                if (static_cast<const RefCounted*>(m_Object)->m_RefCount.fetch_sub(1, std::memory_order_relaxed) == 1)
+                    delete static_cast<const RefCounted*>(m_Object);
+            }
+            else
+            {
+                Header* header = GetHeader();
+                if (--header->RefCount == 0)
+                {
+                    header->DestroyObject(m_Object);
+
+                    header->Free(m_Object);
+                }
+            }
+
+            m_Object = nullptr;
+        }
+
+        template <typename TObject, typename... TArgs>
+        static TObject* Allocate(TArgs&&... args)
+        {
+            if constexpr (Intrusive)
+            {
+                static_assert(IsRefCounted<TObject>, "[Rc] Objects created through an Rc of a RefCounted type have to be RefCounted.");
+                static_assert(std::is_same_v<TAllocator, HeapAllocator>, "[Rc] RefCounted types only support the HeapAllocator.");
+
+                TObject* object = new TObject(std::forward<TArgs>(args)...);
+                static_cast<const RefCounted*>(object)->m_RefCount = 1;
+                return object;
+            }
+            else
+            {
+                using ObjectLayout = Layout<TObject>;
+
+                std::byte* memory = static_cast<std::byte*>(TAllocator::Allocate(ObjectLayout::Size, ObjectLayout::Alignment));
+                Header* header = new (memory + ObjectLayout::Offset - sizeof(Header)) Header();
+                header->DestroyObject = [](void* object) { static_cast<TObject*>(object)->~TObject(); };
+                header->Free = [](void* object) { TAllocator::Free(static_cast<std::byte*>(object) - ObjectLayout::Offset, ObjectLayout::Size, ObjectLayout::Alignment); };
+
+                return new (memory + ObjectLayout::Offset) TObject(std::forward<TArgs>(args)...);
+            }
+        }
+
+    private:
+        T* m_Object;
+
+        template <typename T2, typename TAllocator2>
         friend class Rc;
     };
 
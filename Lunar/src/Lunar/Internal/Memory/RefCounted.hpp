@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
+
+namespace Lunar::Internal
+{
+
+    template<typename T, typename TAllocator> class Arc;
+    template<typename T, typename TAllocator> class Rc;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RefCounted
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Types deriving from RefCounted keep their reference count inside the object, Arc & Rc
+    // detect this and allocate them with a plain new (no separate count), so only the HeapAllocator is supported.
+    // Copies of an object don't share its count, and the destructor is virtual so a derived object can be released through a base.
+    class RefCounted
+    {
+    public:
+        // Constructors & Destructor
+        RefCounted() = default;
+        RefCounted(const RefCounted&) {}
+        virtual ~RefCounted() = default;
+
+        // Operators
+        inline RefCounted& operator = (const RefCounted&) { return *this; }
+
+        // Getters
+        inline uint32_t GetRefCount() const { return m_RefCount.load(std::memory_order_acquire); }
+
+    private:
+        mutable std::atomic<uint32_t> m_RefCount = 0;
+
+        template <typename T2, typename TAllocator>
+        friend class Arc;
+        template <typename T2, typename TAllocator>
+        friend class Rc;
+    };
+
+    template<typename T>
+    inline constexpr bool IsRefCounted = std::is_base_of_v<RefCounted, T>;
+
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "lupch.h"
+#include "ScratchAllocator.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+
+#include "Lunar/Internal/Memory/LinearArena.hpp"
+
+namespace Lunar::Internal
+{
+
+    namespace
+    {
+        class ScratchResource : public std::pmr::memory_resource
+        {
+        public:
+            // Constructor & Destructor
+            ScratchResource()
+                : m_Arena(ScratchAllocator::ChunkSize)
+            {
+            }
+            ~ScratchResource() = default;
+
+        private:
+            // Private methods
+            void* do_allocate(size_t bytes, size_t alignment) override
+            {
+                m_Live++;
+                return m_Arena.Allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void*, size_t, size_t) override
+            {
+                LU_ASSERT((m_Live != 0), "[ScratchAllocator] Deallocated more than was allocated, scratch memory has to be deallocated on the thread that allocated it.");
+
+                // Note: Nothing is using the arena anymore, so it's safe to reuse from the start
+                if (--m_Live == 0)
+                    m_Arena.Reset();
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        private:
+            LinearArena m_Arena;
+            size_t m_Live = 0; // Note: Amount of allocations that haven't been deallocated yet
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    std::pmr::memory_resource* ScratchAllocator::Get()
+    {
+        thread_local ScratchResource s_Resource = {};
+        return &s_Resource;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory_resource>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ScratchAllocator
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Every thread has its own LinearArena for short-lived temporaries, exposed as a std::pmr::memory_resource.
+    // E.g. std::pmr::vector<VkSemaphore> semaphores(ScratchAllocator::Get());
+    // The resource counts its live allocations and resets the arena once the last one is deallocated, so a reset
+    // can never pull memory from under a caller (no matter how many renderers begin frames in between).
+    // Scratch memory has to be deallocated on the thread that allocated it, which pmr containers with scoped lifetimes do.
+    // Note 2: Once an arena has grown to fit its thread's temporaries a steady frame doesn't touch the global heap anymore.
+    // This only holds for long-lived threads, short-lived ones (e.g. a std::async task, Renderer::Record uses persistent workers) pay for a new first chunk every time.
+    class ScratchAllocator
+    {
+    public:
+        constexpr static const size_t ChunkSize = 16ull * 1024ull;
+    public:
+        // Static methods
+        static std::pmr::memory_resource* Get(); // Note: Of the calling thread
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "lupch.h"
+#include "SlabPool.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include <new>
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    SlabPool::SlabPool(size_t blockSize, size_t blocksPerSlab)
+        : m_BlockSize(((std::max(blockSize, sizeof(FreeBlock)) + Alignment - 1) / Alignment) * Alignment), m_BlocksPerSlab(blocksPerSlab)
+    {
+        LU_ASSERT((m_BlocksPerSlab > 0), "[SlabPool] A slab needs to hold at least one block.");
+    }
+
+    SlabPool::~SlabPool()
+    {
+        for (void* slab : m_Slabs)
+            ::operator delete(slab, std::align_val_t(Alignment));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void* SlabPool::Allocate()
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        if (!m_FreeList)
+            AllocateSlab();
+
+        FreeBlock* block = m_FreeList;
+        m_FreeList = block->Next;
+
+        #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING && LU_MEM_PROFILING
+        TracyAllocN(block, m_BlockSize, "SlabPool");
+        #endif
+
+        return block;
+    }
+
+    void SlabPool::Free(void* block)
+    {
+        if (!block)
+            return;
+
+        #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING && LU_MEM_PROFILING
+        TracyFreeN(block, "SlabPool");
+        #endif
+
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+        FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->Next = m_FreeList;
+        m_FreeList = freeBlock;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void SlabPool::AllocateSlab()
+    {
+        std::byte* slab = static_cast<std::byte*>(::operator new(m_BlockSize * m_BlocksPerSlab, std::align_val_t(Alignment)));
+        m_Slabs.push_back(slab);
+
+        // Link the blocks in order, so consecutive allocations are next to each other
+        for (size_t i = m_BlocksPerSlab; i-- > 0;)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i * m_BlockSize));
+            block->Next = m_FreeList;
+            m_FreeList = block;
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // SlabPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Hands out fixed-size blocks carved from larger slabs, freed blocks go onto a free list
+    // and are reused before a new slab is allocated. Slabs are only released when the pool is destroyed.
+    // Every block is aligned to Alignment.
+    class SlabPool
+    {
+    public:
+        constexpr static const size_t Alignment = alignof(std::max_align_t);
+    public:
+        // Constructor & Destructor
+        SlabPool(size_t blockSize, size_t blocksPerSlab = 64);
+        ~SlabPool();
+
+        // Methods
+        void* Allocate();
+        void Free(void* block);
+
+        // Getters
+        inline size_t GetBlockSize() const { return m_BlockSize; }
+
+    private:
+        struct FreeBlock
+        {
+        public:
+            FreeBlock* Next = nullptr;
+        };
+
+    private:
+        // Private methods
+        void AllocateSlab();
+
+    private:
+        size_t m_BlockSize;
+        size_t m_BlocksPerSlab;
+
+        std::mutex m_ThreadSafety = {};
+        FreeBlock* m_FreeList = nullptr;
+        std::vector<void*> m_Slabs = { };
+    };
+
+}
\ No newline at end of file
@@ -14,10 +14,11 @@ namespace Lunar::Internal
     namespace
     {
         static uint8_t s_GLFWInstances = 0;
+        static uint8_t s_HeadlessInstances = 0;
 
         static void GLFWErrorCallBack(int errorCode, const char* description)
         {
-            LU_LOG_ERROR("[GLFW]: ({0}), {1}", errorCode, description);
+            LU_LOG_CAT(Error, Window, "[GLFW]: ({0}), {1}", errorCode, description);
         }
     }
 
@@ -32,6 +33,12 @@ namespace Lunar::Internal
         LU_ASSERT(((specs.Width != 0) && (specs.Height != 0)), "[DesktopWindow] Invalid width & height passed in.");
         LU_ASSERT(static_cast<bool>(specs.EventCallback), "[DesktopWindow] No event callback passed in.");
 
+        if (m_Specification.Headless)
+        {
+            InitHeadless(instance);
+            return;
+        }
+
         // Initialize windowing library
         if (s_GLFWInstances == 0)
         {
@@ -150,6 +157,7 @@ namespace Lunar::Internal
 
             .Buffers = m_Specification.Buffers,
             .VSync = m_Specification.VSync,
+            .DeferredSubmission = m_Specification.DeferredSubmission,
         });
         m_Renderer.Recreate(m_Specification.Width, m_Specification.Height, m_Specification.VSync);
     }
@@ -160,8 +168,15 @@ namespace Lunar::Internal
 
         m_Renderer.Destroy();
 
+        if (m_Specification.Headless)
+        {
+            if ((--s_HeadlessInstances == 0) && (s_GLFWInstances == 0))
+                GraphicsContext::Destroy();
+            return;
+        }
+
         bool destroy = (--s_GLFWInstances == 0);
-        if (destroy)
+        if (destroy && (s_HeadlessInstances == 0))
         {
             GraphicsContext::Destroy();
         }
@@ -182,13 +197,13 @@ namespace Lunar::Internal
     {
         LU_MARK_FRAME();
         LU_PROFILE("DesktopWindow::PollEvents()");
-        glfwPollEvents();
+        if (!m_Specification.Headless)
+            glfwPollEvents();
     }
 
     void DesktopWindow::SwapBuffers()
     {
         LU_PROFILE("DesktopWindow::SwapBuffers()");
-        m_Renderer.FreeQueue();
     }
 
     void DesktopWindow::Resize(uint32_t width, uint32_t height)
@@ -201,6 +216,9 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     Vec2<float> DesktopWindow::GetPosition() const
     {
+        if (m_Specification.Headless)
+            return { 0.0f, 0.0f };
+
         int xPos = 0, yPos = 0;
         glfwGetWindowPos(m_Window, &xPos, &yPos);
 
@@ -213,7 +231,24 @@ namespace Lunar::Internal
     void DesktopWindow::SetTitle(std::string_view title)
     {
         m_Specification.Title = title;
-        glfwSetWindowTitle(m_Window, m_Specification.Title.data());
+        if (!m_Specification.Headless)
+            glfwSetWindowTitle(m_Window, m_Specification.Title.data());
+    }
+
+    void DesktopWindow::SetSize(uint32_t width, uint32_t height)
+    {
+        // Note: Headless windows have no size callback, so we send the event ourselves
+        if (m_Specification.Headless)
+        {
+            m_Specification.Width = width;
+            m_Specification.Height = height;
+
+            WindowResizeEvent event = WindowResizeEvent(width, height);
+            m_Specification.EventCallback(event);
+            return;
+        }
+
+        glfwSetWindowSize(m_Window, static_cast<int>(width), static_cast<int>(height));
     }
 
     void DesktopWindow::SetVSync(bool vsync)
@@ -227,8 +262,37 @@ namespace Lunar::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     double DesktopWindow::GetTime() const
     {
+        if (m_Specification.Headless)
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+
         return glfwGetTime();
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void DesktopWindow::InitHeadless(Window* instance)
+    {
+        // Note: Without a windowing library there's no surface, so the context only requires a graphics queue
+        s_HeadlessInstances++;
+        m_StartTime = std::chrono::steady_clock::now();
+
+        GraphicsContext::AttachWindow(nullptr);
+        if (!GraphicsContext::Initialized())
+            GraphicsContext::Init();
+
+        m_Renderer.Init({
+            .WindowRef = instance,
+
+            .Width = m_Specification.Width,
+            .Height = m_Specification.Height,
+
+            .Buffers = m_Specification.Buffers,
+            .VSync = m_Specification.VSync,
+            .DeferredSubmission = m_Specification.DeferredSubmission,
+        });
+        m_Renderer.Recreate(m_Specification.Width, m_Specification.Height, m_Specification.VSync);
+    }
 #endif
 
 }
\ No newline at end of file
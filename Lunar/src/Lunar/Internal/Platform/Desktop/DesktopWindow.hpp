@@ -6,6 +6,8 @@
 #include "Lunar/Internal/Utils/Preprocessor.hpp"
 #include "Lunar/Internal/Renderer/Renderer.hpp"
 
+#include <chrono>
+
 #if defined(LU_PLATFORM_DESKTOP)
 	#include <GLFW/glfw3.h>
 #endif
@@ -44,6 +46,7 @@ namespace Lunar::Internal
 
 		// Setters
 		void SetTitle(std::string_view title);
+		void SetSize(uint32_t width, uint32_t height);
 		void SetVSync(bool vsync);
 
 		// Additional getters
@@ -56,10 +59,15 @@ namespace Lunar::Internal
 		inline WindowSpecification& GetSpecification() { return m_Specification; }
 		inline Renderer& GetRenderer() { return m_Renderer; }
 
+	private:
+		// Private methods
+		void InitHeadless(Window* instance);
+
 	private:
 		WindowSpecification m_Specification;
 		
-		GLFWwindow* m_Window = nullptr;
+		GLFWwindow* m_Window = nullptr; // Note: nullptr when headless
+		std::chrono::steady_clock::time_point m_StartTime = {}; // Note: Only used when headless
 		
 		bool m_Closed = false;
 		
@@ -3,11 +3,16 @@
 
 #include "Lunar/Internal/IO/Print.hpp"
 #include "Lunar/Internal/Utils/Profiler.hpp"
+#include "Lunar/Internal/Utils/Timings.hpp"
 
 #include "Lunar/Internal/Renderer/Shader.hpp"
 #include "Lunar/Internal/Renderer/Renderer.hpp"
 #include "Lunar/Internal/Renderer/GraphicsContext.hpp"
 
+#include "Lunar/Internal/Renderer/Classes/DepthImagePool.hpp"
+
+#include "Lunar/Internal/Memory/ScratchAllocator.hpp"
+
 #include <array>
 #include <string_view>
 
@@ -30,7 +35,7 @@ namespace
 		layout(location = 2) out vec4 v_Colour;
 		layout(location = 3) flat out uint v_TextureID;
 
-		layout(std140, set = 0, binding = 0) uniform CameraSettings
+		layout(push_constant) uniform CameraSettings
 		{
 			mat4 View;
 			mat4 Projection;
@@ -61,7 +66,7 @@ namespace
 		// Note: underlying type is uint16_t, so will never exceed this value.
 		layout(location = 3) flat in uint v_TextureID;
 
-		layout (set = 0, binding = 1) uniform sampler2D u_Textures[];
+		layout (set = 0, binding = 0) uniform sampler2D u_Textures[];
 
 		void main()
 		{
@@ -90,26 +95,28 @@ namespace Lunar::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	// Init & Destroy
 	////////////////////////////////////////////////////////////////////////////////////
-	void BatchResources2D::Init(const RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation)
+	void BatchResources2D::Init(const RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation, RenderMode mode)
 	{
 		m_RendererID = renderer;
+		m_Mode = mode;
+		m_LoadOperation = loadOperation;
 
 		InitGlobal();
-		InitRenderer(images, loadOperation);
+		InitRenderer(images);
 	}
 
 	void BatchResources2D::Destroy()
 	{
 		m_WhiteTexture.Destroy(m_RendererID);
-		m_CameraBuffer.Destroy(m_RendererID);
 
-		Renderer.DepthImage.Destroy(m_RendererID);
+		DepthImagePool::Release(m_RendererID, Renderer.DepthImage);
 
 		Renderer.Pipeline.Destroy(m_RendererID);
 		Renderer.DescriptorSets.Destroy(m_RendererID);
 		
 		Renderer.CommandBuffer.Destroy(m_RendererID);
-		Renderer.Renderpass.Destroy(m_RendererID);
+		if (m_Mode == RenderMode::Renderpass)
+			Renderer.Renderpass.Destroy(m_RendererID);
 		
 		Renderer.VertexBuffer.Destroy(m_RendererID);
 		Renderer.IndexBuffer.Destroy(m_RendererID);
@@ -120,16 +127,10 @@ namespace Lunar::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	void BatchResources2D::Resize(uint32_t width, uint32_t height)
 	{
-		// TODO: Improve this system
-		auto swapChainImages = Renderer::GetRenderer(m_RendererID).GetSwapChainImages();
-		for (size_t i = 0; i < Renderer.Images.size(); i++)
-		{
-			if (!(swapChainImages[i] == Renderer.Images[i]))
-				Renderer.Images[i]->Resize(m_RendererID, width, height);
-		}
-
-		Renderer.DepthImage.Resize(m_RendererID, width, height);
-		Renderer.Renderpass.Resize(m_RendererID, width, height);
+		// Note: A window drag fires many resize events per frame, so we only
+		// recreate the attachments once, right before they're used again.
+		m_ResizePending = true;
+		m_PendingSize = { width, height };
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -149,23 +150,44 @@ namespace Lunar::Internal
 
 		uint32_t white = 0xFFFFFFFF;
 		m_WhiteTexture.SetData(m_RendererID, &white, sizeof(uint32_t));
+	}
 
-		m_CameraBuffer.Init(m_RendererID, { 
-			.Usage = BufferMemoryUsage::CPUToGPU 
-		}, (sizeof(Mat4) * 2)); // For View & Projection
+	void BatchResources2D::ApplyResize()
+	{
+		if (!m_ResizePending)
+			return;
 
-		std::array<Mat4, 2> cameraData = { Mat4(1.0f), Mat4(1.0f) };
-		m_CameraBuffer.SetData(m_RendererID, cameraData.data(), sizeof(cameraData));
+		m_ResizePending = false;
+		if (m_PendingSize.x == 0 || m_PendingSize.y == 0 || (m_PendingSize.x == Renderer.DepthImage->GetWidth() && m_PendingSize.y == Renderer.DepthImage->GetHeight()))
+			return;
+
+		// TODO: Improve this system
+		auto swapChainImages = Renderer::GetRenderer(m_RendererID).GetSwapChainImages();
+		for (size_t i = 0; i < Renderer.Images.size(); i++)
+		{
+			if (!(swapChainImages[i] == Renderer.Images[i]))
+				Renderer.Images[i]->Resize(m_RendererID, m_PendingSize.x, m_PendingSize.y);
+		}
+
+		// Note: Acquire before releasing, so a pass that's already at the new size keeps the image alive
+		Image* depthImage = DepthImagePool::Acquire(m_RendererID, m_PendingSize.x, m_PendingSize.y);
+		DepthImagePool::Release(m_RendererID, Renderer.DepthImage);
+		Renderer.DepthImage = depthImage;
+
+		// Note: Dynamic rendering has no framebuffers, so the new images are picked up in the next BeginDynamic
+		if (m_Mode == RenderMode::Renderpass)
+		{
+			Renderer.Renderpass.SetDepthAttachment(m_RendererID, Renderer.DepthImage);
+			Renderer.Renderpass.Resize(m_RendererID, m_PendingSize.x, m_PendingSize.y);
+		}
 	}
 
-	void BatchResources2D::InitRenderer(const std::vector<Image*>& images, LoadOperation loadOperation)
+	void BatchResources2D::InitRenderer(const std::vector<Image*>& images)
 	{
 		LU_ASSERT(!images.empty(), "[BatchResources2D] No images passed in to render to.");
 
 		Renderer.Images = images;
 
-		Internal::Renderer& renderer = Renderer::GetRenderer(m_RendererID);
-
 		std::vector<uint32_t> indices;
 		indices.reserve(static_cast<size_t>(BatchRenderer2D::MaxQuads) * 6);
 
@@ -181,34 +203,30 @@ namespace Lunar::Internal
 		}
 
 		// Depth image
-		Renderer.DepthImage.Init(m_RendererID, {
-			.Usage = ImageUsage::DepthStencil | ImageUsage::Sampled,
-			.Layout = ImageLayout::DepthStencil,
-			.Format = renderer.GetDepthFormat(),
-			
-			.Width = images[0]->GetWidth(), .Height = images[0]->GetHeight(),
-
-			.MipMaps = false,
-		}, {});
+		// Note: Nothing reads the depth after the pass, so it's transient & shared between passes of the same size
+		Renderer.DepthImage = DepthImagePool::Acquire(m_RendererID, images[0]->GetWidth(), images[0]->GetHeight());
 
 		// Renderpass
 		Renderer.CommandBuffer.Init(m_RendererID);
-		Renderer.Renderpass.Init(m_RendererID, {
-			.Usage = RenderpassUsage::Graphics,
-
-			.ColourAttachment = images,
-			.ColourLoadOp = loadOperation,
-			.ColourStoreOp = StoreOperation::Store,
-			.ColourClearColour { 0.0f, 0.0f, 0.0f, 1.0f },
-			.PreviousColourImageLayout = ((loadOperation == LoadOperation::Clear) ? ImageLayout::Undefined : ImageLayout::PresentSrcKHR),
-			.FinalColourImageLayout = ImageLayout::PresentSrcKHR,
-
-			.DepthAttachment = &Renderer.DepthImage,
-			.DepthLoadOp = LoadOperation::Clear,
-			.DepthStoreOp = StoreOperation::Store,
-			.PreviousDepthImageLayout = ((loadOperation == LoadOperation::Clear) ? ImageLayout::Undefined : ImageLayout::Undefined),
-			.FinalDepthImageLayout = ImageLayout::DepthStencil,
-		}, &Renderer.CommandBuffer);
+		if (m_Mode == RenderMode::Renderpass)
+		{
+			Renderer.Renderpass.Init(m_RendererID, {
+				.Usage = RenderpassUsage::Graphics,
+
+				.ColourAttachment = images,
+				.ColourLoadOp = m_LoadOperation,
+				.ColourStoreOp = StoreOperation::Store,
+				.ColourClearColour { 0.0f, 0.0f, 0.0f, 1.0f },
+				.PreviousColourImageLayout = ((m_LoadOperation == LoadOperation::Clear) ? ImageLayout::Undefined : ImageLayout::PresentSrcKHR),
+				.FinalColourImageLayout = ImageLayout::PresentSrcKHR,
+
+				.DepthAttachment = Renderer.DepthImage,
+				.DepthLoadOp = LoadOperation::Clear,
+				.DepthStoreOp = StoreOperation::DontCare,
+				.PreviousDepthImageLayout = ImageLayout::Undefined,
+				.FinalDepthImageLayout = ImageLayout::DepthStencil,
+			}, &Renderer.CommandBuffer);
+		}
 
 		// Shader
 		Shader shader(m_RendererID, {
@@ -221,19 +239,27 @@ namespace Lunar::Internal
 		// Descriptorsets
 		Renderer.DescriptorSets.Init(m_RendererID, {
 			{ 1, { 0, {
-				{ DescriptorType::UniformBuffer, 0, "u_Camera", ShaderStage::Vertex },
-				{ DescriptorType::CombinedImageSampler, 1, "u_Textures", ShaderStage::Fragment, BatchRenderer2D::MaxTextures, DescriptorBindingFlags::Default },
+				{ DescriptorType::CombinedImageSampler, 0, "u_Textures", ShaderStage::Fragment, BatchRenderer2D::MaxTextures, DescriptorBindingFlags::Default },
 			}}}
 		});
 
 		// Pipeline
-		Renderer.Pipeline.Init(m_RendererID, {
+		PipelineSpecification pipelineSpecs = {
 			.Usage = PipelineUsage::Graphics,
+			.PushConstants = { { ShaderStage::Vertex, { 0, sizeof(BatchResources2D::Layer::Camera) } } }, // Note: The camera is pushed per layer
 			.Bufferlayout = GetVertexBufferLayout(),
 			.Polygonmode = PolygonMode::Fill,
 			.Cullingmode = CullingMode::None,
-			.Blending = true
-		}, Renderer.DescriptorSets, shader, Renderer.Renderpass);
+			.Blending = true,
+
+			.DynamicColourFormat = images[0]->GetSpecification().Format,
+			.DynamicDepthFormat = Renderer.DepthImage->GetSpecification().Format,
+		};
+
+		if (m_Mode == RenderMode::Renderpass)
+			Renderer.Pipeline.Init(m_RendererID, pipelineSpecs, Renderer.DescriptorSets, shader, Renderer.Renderpass);
+		else
+			Renderer.Pipeline.Init(m_RendererID, pipelineSpecs, Renderer.DescriptorSets, shader);
 		shader.Destroy(m_RendererID);
 
 		// Buffers
@@ -249,12 +275,12 @@ namespace Lunar::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	// Init & Destroy
 	////////////////////////////////////////////////////////////////////////////////////
-	void BatchRenderer2D::Init(const RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation)
+	void BatchRenderer2D::Init(const RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation, RenderMode mode)
 	{
 		#if defined(LU_PLATFORM_APPLE)
-		LU_LOG_WARN("[BatchRenderer2D] BatchRenderer2D only supports {0} simultaneous textures on apple devices. Should be used with care.", MaxTextures);
+		LU_LOG_CAT(Warn, Batch, "[BatchRenderer2D] BatchRenderer2D only supports {0} simultaneous textures on apple devices. Should be used with care.", MaxTextures);
 		#endif
-		m_Resources.Init(renderer, images, loadOperation);
+		m_Resources.Init(renderer, images, loadOperation, mode);
 	}
 
 	void BatchRenderer2D::Destroy()
@@ -268,6 +294,7 @@ namespace Lunar::Internal
 	void BatchRenderer2D::Begin()
 	{
 		LU_PROFILE("BatchRenderer2D::Begin()");
+		LU_TIME("BatchRenderer2D::Begin");
 		m_Resources.m_CPUBuffer.clear();
 
 		m_Resources.m_CurrentTextureIndex = 0;
@@ -275,16 +302,20 @@ namespace Lunar::Internal
 
 		// Set the white texture to index 0
 		m_Resources.m_TextureIndices[&m_Resources.m_WhiteTexture] = m_Resources.m_CurrentTextureIndex++;
+
+		// Note: The depth of the first layer is cleared by the renderpass/render scope itself
+		m_Resources.m_Layers.clear();
+		m_Resources.m_Layers.push_back({ m_Resources.m_Camera, 0, false });
 	}
 
 	void BatchRenderer2D::End()
 	{
 		LU_PROFILE("BatchRenderer2D::End()");
-		std::vector<Uploadable> uploadQueue;
-		uploadQueue.reserve(m_Resources.m_TextureIndices.size() + 1); // + 1 for the Camera Buffer.
+		LU_TIME("BatchRenderer2D::End");
+		std::pmr::vector<Uploadable> uploadQueue(ScratchAllocator::Get());
+		uploadQueue.reserve(m_Resources.m_TextureIndices.size());
 		{
 			LU_PROFILE("BatchRenderer2D::End::FormUploadQueue");
-			uploadQueue.push_back({ &m_Resources.m_CameraBuffer, m_Resources.Renderer.DescriptorSets.GetLayout(0).GetDescriptorByName("u_Camera") });
 
 			// Upload all images
 			const auto& descriptor = m_Resources.Renderer.DescriptorSets.GetLayout(0).GetDescriptorByName("u_Textures");
@@ -308,32 +339,33 @@ namespace Lunar::Internal
 	void BatchRenderer2D::Flush()
 	{
 		LU_PROFILE("BatchRenderer2D::Flush()");
+		LU_TIME("BatchRenderer2D::Flush");
+		m_Resources.ApplyResize();
 
-		Renderer& renderer = Renderer::GetRenderer(m_Resources.m_RendererID);
-
-		// Start rendering
-		renderer.Begin(m_Resources.Renderer.Renderpass);
-
-		CommandBuffer& cmdBuf = m_Resources.Renderer.Renderpass.GetCommandBuffer();
-		m_Resources.Renderer.Pipeline.Use(m_Resources.m_RendererID, cmdBuf, PipelineBindPoint::Graphics);
-
-		m_Resources.Renderer.DescriptorSets.GetSets(0)[0]->Bind(m_Resources.m_RendererID, m_Resources.Renderer.Pipeline, cmdBuf);
-
-		m_Resources.Renderer.IndexBuffer.Bind(m_Resources.m_RendererID, cmdBuf);
-		m_Resources.Renderer.VertexBuffer.Bind(m_Resources.m_RendererID, cmdBuf);
+		if (m_Resources.m_Mode == RenderMode::Renderpass)
+			FlushRenderpass();
+		else
+			FlushDynamic();
+	}
 
-		// Draw all at once
-		renderer.DrawIndexed(cmdBuf, static_cast<uint32_t>(((m_Resources.m_CPUBuffer.size() / 4ull) * 6ull)), 1);
+	void BatchRenderer2D::SetCamera(const Mat4& view, const Mat4& projection)
+	{
+		m_Resources.m_Camera = { view, projection };
+		if (m_Resources.m_Layers.empty())
+			return;
 
-		// End rendering
-		renderer.End(m_Resources.Renderer.Renderpass);
-		renderer.Submit(m_Resources.Renderer.Renderpass, ExecutionPolicy::InOrder);
+		// Note: Quads already added keep the camera they were added with, so they're split into a new layer (without a depth clear)
+		BatchResources2D::Layer& layer = m_Resources.m_Layers.back();
+		if (layer.FirstQuad == GetQuadCount())
+			layer.Camera = m_Resources.m_Camera;
+		else
+			m_Resources.m_Layers.push_back({ m_Resources.m_Camera, GetQuadCount(), false });
 	}
 
-	void BatchRenderer2D::SetCamera(const Mat4& view, const Mat4& projection)
+	void BatchRenderer2D::NextLayer(bool clearDepth)
 	{
-		std::array<Mat4, 2> cameraData = { view, projection };
-		m_Resources.m_CameraBuffer.SetData(m_Resources.m_RendererID, cameraData.data(), sizeof(cameraData));
+		LU_ASSERT(!m_Resources.m_Layers.empty(), "[BatchRenderer2D] NextLayer() called outside of Begin() & End().");
+		m_Resources.m_Layers.push_back({ m_Resources.m_Camera, GetQuadCount(), clearDepth });
 	}
 
 	void BatchRenderer2D::AddQuad(const Vec3<float>& position, const Vec2<float>& size, const Vec4<float>& colour)
@@ -352,7 +384,7 @@ namespace Lunar::Internal
 		#if !defined(LU_CONFIG_DIST)
 		if ((m_Resources.m_CPUBuffer.size() / 4u) >= BatchRenderer2D::MaxQuads) [[unlikely]]
 		{
-			LU_LOG_WARN("[BatchRenderer2D] Reached max amount of quads ({0}), to support more either manually change BatchRenderer2D::MaxQuads or contact the developer.", BatchRenderer2D::MaxQuads);
+			LU_LOG_LIMITED(Warn, Batch, "[BatchRenderer2D] Reached max amount of quads ({0}), to support more either manually change BatchRenderer2D::MaxQuads or contact the developer.", BatchRenderer2D::MaxQuads);
 			return;
 		}
 		#endif
@@ -377,10 +409,93 @@ namespace Lunar::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	// Private methods
 	////////////////////////////////////////////////////////////////////////////////////
+	void BatchRenderer2D::FlushRenderpass()
+	{
+		Renderer& renderer = Renderer::GetRenderer(m_Resources.m_RendererID);
+
+		// Start rendering
+		renderer.Begin(m_Resources.Renderer.Renderpass);
+		Draw(m_Resources.Renderer.Renderpass.GetCommandBuffer());
+
+		// End rendering
+		renderer.End(m_Resources.Renderer.Renderpass);
+		renderer.Submit(m_Resources.Renderer.Renderpass, ExecutionPolicy::InOrder);
+	}
+
+	void BatchRenderer2D::FlushDynamic()
+	{
+		Renderer& renderer = Renderer::GetRenderer(m_Resources.m_RendererID);
+		CommandBuffer& cmdBuf = m_Resources.Renderer.CommandBuffer;
+
+		const auto& images = m_Resources.Renderer.Images;
+		Image* target = ((images.size() == 1) ? images[0] : images[renderer.GetAcquiredImage()]);
+		Image* depth = m_Resources.Renderer.DepthImage;
+
+		renderer.Begin(cmdBuf);
+
+		// Note: Same layouts as the static renderpass, the depth is never stored so its contents can always be discarded
+		const ImageTransition begin[] = {
+			{ target, ((m_Resources.m_LoadOperation == LoadOperation::Clear) ? ImageLayout::Undefined : ImageLayout::PresentSrcKHR), ImageLayout::Colour },
+			{ depth, ImageLayout::Undefined, ImageLayout::DepthStencil },
+		};
+		renderer.Transition(cmdBuf, begin);
+
+		Image* const colourAttachments[] = { target };
+		renderer.BeginDynamic(cmdBuf, {
+			.ColourAttachments = colourAttachments,
+			.ColourLoadOp = m_Resources.m_LoadOperation,
+			.ColourStoreOp = StoreOperation::Store,
+
+			.DepthAttachment = depth,
+			.DepthLoadOp = LoadOperation::Clear,
+			.DepthStoreOp = StoreOperation::DontCare,
+		});
+		renderer.SetViewportAndScissor(cmdBuf, target->GetWidth(), target->GetHeight());
+
+		Draw(cmdBuf);
+
+		renderer.EndDynamic(cmdBuf);
+		const ImageTransition end[] = { { target, ImageLayout::Colour, ImageLayout::PresentSrcKHR } };
+		renderer.Transition(cmdBuf, end);
+
+		renderer.End(cmdBuf);
+		renderer.Submit(cmdBuf, ExecutionPolicy::InOrder);
+	}
+
+	void BatchRenderer2D::Draw(CommandBuffer& cmdBuf)
+	{
+		Renderer& renderer = Renderer::GetRenderer(m_Resources.m_RendererID);
+		LU_PROFILE_GPU(renderer, cmdBuf, "BatchRenderer2D::Draw");
+		renderer.AddFrameStat(FrameStat::Quads, GetQuadCount());
+
+		m_Resources.Renderer.Pipeline.Use(m_Resources.m_RendererID, cmdBuf, PipelineBindPoint::Graphics);
+
+		m_Resources.Renderer.DescriptorSets.GetSets(0)[0]->Bind(m_Resources.m_RendererID, m_Resources.Renderer.Pipeline, cmdBuf);
+
+		m_Resources.Renderer.IndexBuffer.Bind(m_Resources.m_RendererID, cmdBuf);
+		m_Resources.Renderer.VertexBuffer.Bind(m_Resources.m_RendererID, cmdBuf);
+
+		// Draw every layer as a range of the same buffers, so all layers share one render scope & submit
+		const auto& layers = m_Resources.m_Layers;
+		for (size_t i = 0; i < layers.size(); i++)
+		{
+			const BatchResources2D::Layer& layer = layers[i];
+			const uint32_t endQuad = ((i + 1 < layers.size()) ? layers[i + 1].FirstQuad : GetQuadCount());
+
+			if (layer.ClearDepth)
+				renderer.ClearDepth(cmdBuf, m_Resources.Renderer.DepthImage->GetWidth(), m_Resources.Renderer.DepthImage->GetHeight());
+			if (endQuad == layer.FirstQuad)
+				continue;
+
+			m_Resources.Renderer.Pipeline.PushConstant(m_Resources.m_RendererID, cmdBuf, ShaderStage::Vertex, (void*)layer.Camera.data());
+			renderer.DrawIndexed(cmdBuf, (endQuad - layer.FirstQuad) * 6u, 1, layer.FirstQuad * 6u);
+		}
+	}
+
 	uint32_t BatchRenderer2D::GetTextureID(Image* image)
 	{
-		// If nullptr return white texture
-		if (image == nullptr)
+		// If nullptr (or still streaming in, or failed to stream in) return white texture
+		if (image == nullptr || !image->IsLoaded())
 			return m_Resources.m_TextureIndices[&m_Resources.m_WhiteTexture];
 
 		// Check if texture is has not been cached
@@ -389,7 +504,7 @@ namespace Lunar::Internal
 			#if !defined(LU_CONFIG_DIST)
 			if (m_Resources.m_CurrentTextureIndex >= (BatchRenderer2D::MaxTextures - 1)) [[unlikely]]
 			{
-				LU_LOG_WARN("[BatchRenderer2D] Reached max amount of textures ({0}), to support more either manually change BatchRenderer2D::MaxTextures or contact the developer. Be aware that apple devices have a very low hardware-set limit.", BatchRenderer2D::MaxTextures);
+				LU_LOG_LIMITED(Warn, Batch, "[BatchRenderer2D] Reached max amount of textures ({0}), to support more either manually change BatchRenderer2D::MaxTextures or contact the developer. Be aware that apple devices have a very low hardware-set limit.", BatchRenderer2D::MaxTextures);
 				return 0;
 			}
 			#endif
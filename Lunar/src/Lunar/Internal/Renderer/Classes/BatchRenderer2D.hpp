@@ -12,6 +12,7 @@
 
 #include "Lunar/Maths/Structs.hpp"
 
+#include <array>
 #include <cstdint>
 
 namespace Lunar::Internal
@@ -45,34 +46,42 @@ namespace Lunar::Internal
 			~Vertex() = default;
 		};
 
+		// Note: A range of quads drawn with its own camera, all layers are drawn in one render scope
+		struct Layer
+		{
+		public:
+			std::array<Mat4, 2> Camera = { Mat4(1.0f), Mat4(1.0f) }; // View & Projection
+			uint32_t FirstQuad = 0;
+			bool ClearDepth = false;
+		};
+
 	public:
 		// Constructor & Destructor
 		BatchResources2D() = default;
 		~BatchResources2D() = default;
 
 		// Init & Destroy
-		void Init(const Internal::RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation);
+		void Init(const Internal::RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation, RenderMode mode);
 		void Destroy();
 
 		// Methods
-		void Resize(uint32_t width, uint32_t height);
+		void Resize(uint32_t width, uint32_t height); // Note: Only records the size, the attachments are recreated on the next Flush
 
 	private:
 		// Global
 		Image m_WhiteTexture;
-		UniformBuffer m_CameraBuffer;
 
 		// Renderer
 		struct
 		{
 			std::vector<Image*> Images = { };
-			Image DepthImage = {};
+			Image* DepthImage = nullptr; // Note: Shared with other passes of the same size, see DepthImagePool
 
 			Pipeline Pipeline = {};
 			DescriptorSets DescriptorSets = {};
 
 			CommandBuffer CommandBuffer = {};
-			Renderpass Renderpass = {};
+			Renderpass Renderpass = {}; // Note: Only used with RenderMode::Renderpass
 
 			VertexBuffer VertexBuffer = {};
 			IndexBuffer IndexBuffer = {};
@@ -80,15 +89,25 @@ namespace Lunar::Internal
 
 		// State
 		RendererID m_RendererID = 0;
+		RenderMode m_Mode = RenderMode::Renderpass;
+		LoadOperation m_LoadOperation = LoadOperation::Clear;
 		std::vector<Vertex> m_CPUBuffer = { };
+
+		std::array<Mat4, 2> m_Camera = { Mat4(1.0f), Mat4(1.0f) };
+		std::vector<Layer> m_Layers = { };
 		
 		uint32_t m_CurrentTextureIndex = 0;
 		std::unordered_map<Image*, uint32_t> m_TextureIndices = { };
 
+		bool m_ResizePending = false;
+		Vec2<uint32_t> m_PendingSize = { 0, 0 };
+
 	private:
 		// Private methods
 		void InitGlobal();
-		void InitRenderer(const std::vector<Image*>& images, LoadOperation loadOperation);
+		void InitRenderer(const std::vector<Image*>& images);
+
+		void ApplyResize();
 
 		friend class BatchRenderer2D;
 	};
@@ -112,7 +131,8 @@ namespace Lunar::Internal
 		~BatchRenderer2D() = default;
 
 		// Init & Destroy
-		void Init(const Internal::RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation = LoadOperation::Clear);
+		// Note: With RenderMode::Dynamic no renderpass or framebuffers are created, so resizing only recreates the images
+		void Init(const Internal::RendererID renderer, const std::vector<Image*>& images, LoadOperation loadOperation = LoadOperation::Clear, RenderMode mode = RenderMode::Renderpass);
 		void Destroy();
 
 		// Methods
@@ -121,6 +141,8 @@ namespace Lunar::Internal
 		void Flush();
 
 		void SetCamera(const Mat4& view, const Mat4& projection);
+		// Note: Starts a new layer drawn on top of the previous ones in the same render scope, optionally with a cleared depth
+		void NextLayer(bool clearDepth = true);
 
 		// Note: We multiply the Z-axis by -1, so the depth is from 0 to 1
 		void AddQuad(const Vec3<float>& position, const Vec2<float>& size, const Vec4<float>& colour);
@@ -130,6 +152,12 @@ namespace Lunar::Internal
 		void Resize(uint32_t width, uint32_t height);
 
 	private:
+		void FlushRenderpass();
+		void FlushDynamic();
+		void Draw(CommandBuffer& cmdBuf);
+
+		inline uint32_t GetQuadCount() const { return static_cast<uint32_t>(m_Resources.m_CPUBuffer.size() / 4ull); }
+
 		uint32_t GetTextureID(Image* image);
 
 	private:
@@ -0,0 +1,78 @@
+#include "lupch.h"
+#include "DepthImagePool.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+
+#include "Lunar/Internal/Renderer/Renderer.hpp"
+
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+	namespace
+	{
+		struct PooledDepthImage
+		{
+		public:
+			RendererID Renderer = 0;
+			uint32_t Width = 0, Height = 0;
+
+			uint32_t References = 0;
+			std::unique_ptr<Image> DepthImage = nullptr; // Note: Heap allocated so the pointer stays valid when the vector grows
+		};
+
+		static std::mutex s_PoolMutex = {};
+		static std::vector<PooledDepthImage> s_Pool = { };
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Static methods
+	////////////////////////////////////////////////////////////////////////////////////
+	Image* DepthImagePool::Acquire(const RendererID renderer, uint32_t width, uint32_t height)
+	{
+		std::scoped_lock<std::mutex> lock(s_PoolMutex);
+
+		auto it = std::find_if(s_Pool.begin(), s_Pool.end(), [=](const PooledDepthImage& entry) { return entry.Renderer == renderer && entry.Width == width && entry.Height == height; });
+		if (it != s_Pool.end())
+		{
+			it->References++;
+			return it->DepthImage.get();
+		}
+
+		PooledDepthImage& entry = s_Pool.emplace_back();
+		entry.Renderer = renderer;
+		entry.Width = width;
+		entry.Height = height;
+		entry.References = 1;
+		entry.DepthImage = std::make_unique<Image>(renderer, ImageSpecification({
+			.Usage = ImageUsage::DepthStencil | ImageUsage::Transient,
+			.Layout = ImageLayout::DepthStencil,
+			.Format = Renderer::GetRenderer(renderer).GetDepthFormat(),
+
+			.Width = width, .Height = height,
+
+			.MipMaps = false,
+		}), SamplerSpecification());
+
+		return entry.DepthImage.get();
+	}
+
+	void DepthImagePool::Release(const RendererID renderer, Image* image)
+	{
+		std::scoped_lock<std::mutex> lock(s_PoolMutex);
+
+		auto it = std::find_if(s_Pool.begin(), s_Pool.end(), [=](const PooledDepthImage& entry) { return entry.DepthImage.get() == image; });
+		LU_ASSERT((it != s_Pool.end()), "[DepthImagePool] Released an image that wasn't acquired from the pool.");
+
+		if (--it->References > 0)
+			return;
+
+		it->DepthImage->Destroy(renderer);
+		s_Pool.erase(it);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Lunar/Internal/Renderer/Image.hpp"
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+
+#include <cstdint>
+
+namespace Lunar::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// DepthImagePool
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Hands out one reference counted depth image per (renderer, width, height).
+	// The images are transient, so they can only be cleared & tested against within
+	// a renderpass (DepthStoreOp should be DontCare) and are never sampled.
+	class DepthImagePool
+	{
+	public:
+		// Static methods
+		static Image* Acquire(const RendererID renderer, uint32_t width, uint32_t height);
+		static void Release(const RendererID renderer, Image* image); // Note: Destroys the image once no renderpass uses it anymore
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#include "lupch.h"
+#include "RenderGraph.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include <algorithm>
+
+namespace Lunar::Internal
+{
+
+	namespace
+	{
+		static bool Accesses(const std::vector<RenderGraphImage>& images, const Image* image)
+		{
+			return std::any_of(images.begin(), images.end(), [image](const RenderGraphImage& entry) { return entry.Target == image; });
+		}
+
+		static bool Contains(const std::vector<std::pair<Image*, ImageLayout>>& entries, const Image* image)
+		{
+			return std::any_of(entries.begin(), entries.end(), [image](const auto& entry) { return entry.first == image; });
+		}
+
+		static void Set(std::vector<std::pair<Image*, ImageLayout>>& entries, Image* image, ImageLayout layout)
+		{
+			auto it = std::find_if(entries.begin(), entries.end(), [image](const auto& entry) { return entry.first == image; });
+			if (it != entries.end())
+				it->second = layout;
+			else
+				entries.emplace_back(image, layout);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Init & Destroy
+	////////////////////////////////////////////////////////////////////////////////////
+	void RenderGraph::Init(const RendererID renderer)
+	{
+		m_RendererID = renderer;
+		m_CommandBuffer.Init(m_RendererID);
+	}
+
+	void RenderGraph::Destroy()
+	{
+		Reset();
+		m_CommandBuffer.Destroy(m_RendererID);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Building
+	////////////////////////////////////////////////////////////////////////////////////
+	void RenderGraph::Import(Image* image, ImageLayout current)
+	{
+		Set(m_Imported, image, current);
+	}
+
+	void RenderGraph::Output(Image* image, ImageLayout final)
+	{
+		Set(m_Outputs, image, final);
+	}
+
+	void RenderGraph::AddPass(RenderGraphPass&& pass)
+	{
+		m_Passes.push_back(std::move(pass));
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void RenderGraph::Execute(ExecutionPolicy policy)
+	{
+		LU_PROFILE("RenderGraph::Execute()");
+
+		{
+			LU_PROFILE("RenderGraph::Execute::Compile");
+			Cull();
+			Sort();
+		}
+
+		m_CulledPasses = static_cast<uint32_t>(m_Passes.size() - m_Order.size());
+		if (m_Order.empty())
+		{
+			Reset();
+			return;
+		}
+
+		Renderer& renderer = Renderer::GetRenderer(m_RendererID);
+		renderer.Begin(m_CommandBuffer);
+
+		for (const auto& [image, layout] : m_Imported)
+			GetState(image).Layout = layout;
+
+		for (uint32_t index : m_Order)
+		{
+			RenderGraphPass& pass = m_Passes[index];
+
+			// Gather the pass's accesses, an image that's read & written counts as a write
+			m_Accesses.clear();
+			for (const auto& write : pass.Writes)
+				m_Accesses.push_back({ write.Target, write.Layout, true });
+			for (const auto& read : pass.Reads)
+			{
+				if (!Accesses(pass.Writes, read.Target))
+					m_Accesses.push_back({ read.Target, read.Layout, false });
+			}
+
+			// Note: Reads after reads in the same layout don't need a barrier, everything else does
+			m_Transitions.clear();
+			for (const auto& access : m_Accesses)
+			{
+				ImageState& state = GetState(access.Target);
+
+				#if !defined(LU_CONFIG_DIST)
+				if (!access.Write && state.Layout == ImageLayout::Undefined)
+					LU_LOG_LIMITED(Warn, Renderer, "[RenderGraph] Pass '{0}' reads an image that was never written or imported.", pass.Name);
+				#endif
+
+				if (state.Layout != access.Layout || state.Written || access.Write)
+					m_Transitions.push_back({ access.Target, state.Layout, access.Layout });
+
+				state.Layout = access.Layout;
+				state.Written = access.Write;
+			}
+
+			renderer.Transition(m_CommandBuffer, m_Transitions);
+
+			LU_PROFILE("RenderGraph::Execute::Pass");
+			LU_PROFILE_GPU(renderer, m_CommandBuffer, Intern(pass.Name));
+			pass.Execute(m_CommandBuffer);
+		}
+
+		// Move all outputs into their final layouts with one barrier
+		m_Transitions.clear();
+		for (const auto& [image, final] : m_Outputs)
+		{
+			auto it = std::find_if(m_States.begin(), m_States.end(), [image](const ImageState& state) { return state.Target == image; });
+			if (it != m_States.end() && it->Layout != final)
+				m_Transitions.push_back({ image, it->Layout, final });
+		}
+		renderer.Transition(m_CommandBuffer, m_Transitions);
+
+		renderer.End(m_CommandBuffer);
+		renderer.Submit(m_CommandBuffer, policy);
+
+		Reset();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void RenderGraph::Cull()
+	{
+		std::vector<bool>& needed = m_Needed;
+		needed.assign(m_Passes.size(), false);
+
+		// Passes that write an output (or have side effects) are always needed
+		for (size_t i = 0; i < m_Passes.size(); i++)
+		{
+			const RenderGraphPass& pass = m_Passes[i];
+			needed[i] = pass.SideEffects || std::any_of(pass.Writes.begin(), pass.Writes.end(), [this](const RenderGraphImage& write) { return Contains(m_Outputs, write.Target); });
+		}
+
+		// Walk backwards, every earlier pass that writes an image a needed pass reads is needed too
+		// Note: Since passes are only ever read from earlier passes a single backwards walk suffices
+		for (size_t i = m_Passes.size(); i-- > 0;)
+		{
+			if (!needed[i])
+				continue;
+
+			for (const auto& read : m_Passes[i].Reads)
+			{
+				for (size_t j = 0; j < i; j++)
+				{
+					if (!needed[j] && Accesses(m_Passes[j].Writes, read.Target))
+						needed[j] = true;
+				}
+			}
+		}
+	}
+
+	void RenderGraph::Sort()
+	{
+		// Note: Dependencies always point to earlier passes, so the declaration order is a valid order.
+		// We only move independent passes between dependent ones, so consecutive passes need fewer barriers.
+		const std::vector<bool>& needed = m_Needed;
+		std::vector<bool>& scheduled = m_Scheduled;
+		std::vector<uint32_t>& order = m_Order;
+
+		scheduled.assign(m_Passes.size(), false);
+		order.clear();
+
+		const size_t count = static_cast<size_t>(std::count(needed.begin(), needed.end(), true));
+		order.reserve(count);
+
+		while (order.size() < count)
+		{
+			int64_t candidate = -1;
+			for (size_t i = 0; i < m_Passes.size(); i++)
+			{
+				if (!needed[i] || scheduled[i])
+					continue;
+
+				bool ready = true;
+				for (size_t j = 0; j < i && ready; j++)
+				{
+					if (needed[j] && !scheduled[j] && DependsOn(m_Passes[i], m_Passes[j]))
+						ready = false;
+				}
+				if (!ready)
+					continue;
+
+				// Prefer a pass that doesn't depend on the one we just scheduled
+				if (order.empty() || !DependsOn(m_Passes[i], m_Passes[order.back()]))
+				{
+					candidate = static_cast<int64_t>(i);
+					break;
+				}
+				if (candidate == -1)
+					candidate = static_cast<int64_t>(i);
+			}
+
+			LU_ASSERT((candidate != -1), "[RenderGraph] Failed to order passes.");
+			scheduled[static_cast<size_t>(candidate)] = true;
+			order.push_back(static_cast<uint32_t>(candidate));
+		}
+	}
+
+	bool RenderGraph::DependsOn(const RenderGraphPass& pass, const RenderGraphPass& previous) const
+	{
+		// Read after write & write after write
+		for (const auto& write : previous.Writes)
+		{
+			if (Accesses(pass.Reads, write.Target) || Accesses(pass.Writes, write.Target))
+				return true;
+		}
+
+		// Write after read
+		for (const auto& read : previous.Reads)
+		{
+			if (Accesses(pass.Writes, read.Target))
+				return true;
+		}
+
+		return false;
+	}
+
+	RenderGraph::ImageState& RenderGraph::GetState(Image* image)
+	{
+		auto it = std::find_if(m_States.begin(), m_States.end(), [image](const ImageState& state) { return state.Target == image; });
+		if (it != m_States.end())
+			return *it;
+
+		return m_States.emplace_back(ImageState { .Target = image });
+	}
+
+	const char* RenderGraph::Intern(const std::string& name)
+	{
+		auto it = m_PassNames.find(name);
+		if (it == m_PassNames.end())
+			it = m_PassNames.insert(name).first;
+
+		return it->c_str();
+	}
+
+	void RenderGraph::Reset()
+	{
+		m_Passes.clear();
+		m_Imported.clear();
+		m_Outputs.clear();
+		m_States.clear();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Lunar/Internal/Renderer/Image.hpp"
+#include "Lunar/Internal/Renderer/Renderer.hpp"
+#include "Lunar/Internal/Renderer/RendererSpec.hpp"
+#include "Lunar/Internal/Renderer/CommandBuffer.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <unordered_set>
+
+namespace Lunar::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// RenderGraph specs
+	////////////////////////////////////////////////////////////////////////////////////
+	struct RenderGraphImage
+	{
+	public:
+		Image* Target = nullptr;
+		ImageLayout Layout = ImageLayout::ShaderRead; // The layout the pass expects the image in
+	};
+
+	struct RenderGraphPass
+	{
+	public:
+		std::string Name = {}; // Note: Also names the pass's GPU zone
+
+		std::vector<RenderGraphImage> Reads = { };
+		std::vector<RenderGraphImage> Writes = { };
+
+		bool SideEffects = false; // Note: Passes with side effects (e.g. readbacks) are never culled
+
+		// Note: Records into the graph's CommandBuffer, which has already been begun.
+		// Use Renderer::BeginDynamic/EndDynamic for rendering, static Renderpasses own their CommandBuffer.
+		std::function<void(CommandBuffer&)> Execute = {};
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// RenderGraph
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: The graph is rebuilt every frame. Execute() culls passes that don't contribute to an output,
+	// orders the rest by their dependencies, merges each pass's layout transitions into a single barrier
+	// and records everything into one CommandBuffer with one submit.
+	// Note 2: All bookkeeping lives in vectors that are cleared (not freed) every frame, so a steady graph
+	// only allocates for what the caller builds (pass names, Reads/Writes & Execute).
+	class RenderGraph
+	{
+	public:
+		// Constructor & Destructor
+		RenderGraph() = default;
+		~RenderGraph() = default;
+
+		// Init & Destroy
+		void Init(const RendererID renderer);
+		void Destroy();
+
+		// Building
+		void Import(Image* image, ImageLayout current); // Note: Images that aren't imported start as Undefined, so their contents are discarded
+		void Output(Image* image, ImageLayout final); // Note: E.g. the swapchain image with PresentSrcKHR
+		void AddPass(RenderGraphPass&& pass);
+
+		// Methods
+		void Execute(ExecutionPolicy policy = ExecutionPolicy::InOrder);
+
+		// Getters
+		inline CommandBuffer& GetCommandBuffer() { return m_CommandBuffer; }
+		inline uint32_t GetCulledPassCount() const { return m_CulledPasses; } // Note: Of the last Execute()
+
+	private:
+		struct ImageState
+		{
+		public:
+			Image* Target = nullptr;
+			ImageLayout Layout = ImageLayout::Undefined;
+			bool Written = false; // Note: By the last pass that used it
+		};
+
+		struct ImageAccess
+		{
+		public:
+			Image* Target = nullptr;
+			ImageLayout Layout = ImageLayout::Undefined;
+			bool Write = false;
+		};
+
+	private:
+		// Private methods
+		void Cull();
+		void Sort();
+		bool DependsOn(const RenderGraphPass& pass, const RenderGraphPass& previous) const;
+
+		ImageState& GetState(Image* image);
+		const char* Intern(const std::string& name);
+
+		void Reset();
+
+	private:
+		RendererID m_RendererID = 0;
+		CommandBuffer m_CommandBuffer = {};
+
+		std::vector<RenderGraphPass> m_Passes = { };
+		std::vector<std::pair<Image*, ImageLayout>> m_Imported = { }; // Note: A graph only touches a handful of images, so these are searched linearly
+		std::vector<std::pair<Image*, ImageLayout>> m_Outputs = { };
+
+		// Execute() state
+		std::vector<bool> m_Needed = { };
+		std::vector<bool> m_Scheduled = { };
+		std::vector<uint32_t> m_Order = { };
+		std::vector<ImageState> m_States = { };
+		std::vector<ImageAccess> m_Accesses = { };
+		std::vector<ImageTransition> m_Transitions = { };
+
+		std::unordered_set<std::string> m_PassNames = { }; // Note: The GPU zones refer to these until their results are read back, frames later, so they're never cleared
+
+		uint32_t m_CulledPasses = 0;
+	};
+
+}
\ No newline at end of file
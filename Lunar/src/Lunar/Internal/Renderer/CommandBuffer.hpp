@@ -25,14 +25,17 @@ namespace Lunar::Internal
     public:
         // Constructors & Destructor
 		inline CommandBuffer() = default;
-		inline CommandBuffer(const RendererID renderer) { Init(renderer); }
+		inline CommandBuffer(const RendererID renderer, CommandBufferLevel level = CommandBufferLevel::Primary) { Init(renderer, level); }
 		inline ~CommandBuffer() = default;
 
         // Init & Destroy
-		inline void Init(const RendererID renderer) { m_CommandBuffer.Init(renderer); }
+		inline void Init(const RendererID renderer, CommandBufferLevel level = CommandBufferLevel::Primary) { m_CommandBuffer.Init(renderer, level); }
         inline void Destroy(const RendererID renderer) { m_CommandBuffer.Destroy(renderer); }
 
         // The Begin, End & Submit methods are in the Renderer class.
+
+        // Getters
+        inline CommandBufferLevel GetLevel() const { return m_CommandBuffer.GetLevel(); }
         
         // Internal methods
 		inline CommandBufferType& GetInternalCommandBuffer() { return m_CommandBuffer; }
@@ -45,7 +45,7 @@ namespace Lunar::Internal
         // Methods
         inline void Bind(const RendererID renderer, Pipeline& pipeline, CommandBuffer& cmdBuf, PipelineBindPoint bindPoint = PipelineBindPoint::Graphics, const std::vector<uint32_t>& dynamicOffsets = { }) { m_Descriptor.Bind(renderer, pipeline, cmdBuf, bindPoint, dynamicOffsets); }
 
-        inline void Upload(const RendererID renderer, const std::vector<Uploadable>& elements) { m_Descriptor.Upload(renderer, elements); } // Uploads to the current frame descriptorset.
+        inline void Upload(const RendererID renderer, std::span<const Uploadable> elements) { m_Descriptor.Upload(renderer, elements); } // Uploads to the current frame descriptorset.
 
         // Internal
         inline DescriptorSetType& GetInternalDescriptorSet() { return m_Descriptor; }
@@ -32,8 +32,7 @@ namespace Lunar::Internal
 
     void GraphicsContext::Init()
     {
-        LU_ASSERT(s_ActiveWindow, "[GraphicsContext] No window has been attached.");
-
+        // Note: Without an attached window the context is headless, it won't be able to present to a window created later
         s_GraphicsContext.Init(s_ActiveWindow);
         s_Initialized = true;
     }
@@ -29,7 +29,7 @@ namespace Lunar::Internal
 		static bool Initialized();
 
 		// Static methods
-		static void AttachWindow(void* nativeWindow);
+		static void AttachWindow(void* nativeWindow); // Note: nullptr for a headless context
 
 		static void Init();
 		static void Destroy();
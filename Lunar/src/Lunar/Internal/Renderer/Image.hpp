@@ -7,6 +7,8 @@
 
 #include "Lunar/Internal/API/Vulkan/VulkanImage.hpp"
 
+#include <vector>
+#include <cstdint>
 #include <filesystem>
 
 namespace Lunar::Internal
@@ -37,10 +39,12 @@ namespace Lunar::Internal
         // Init & Destroy
 		inline void Init(const RendererID renderer, const ImageSpecification& specs, const SamplerSpecification& samplerSpecs) { m_Image.Init(renderer, specs, samplerSpecs); }
 		inline void Init(const RendererID renderer, const ImageSpecification& specs, const SamplerSpecification& samplerSpecs, const std::filesystem::path& imagePath) { m_Image.Init(renderer, specs, samplerSpecs, imagePath); }
+		inline void InitAsync(const RendererID renderer, const ImageSpecification& specs, const SamplerSpecification& samplerSpecs, const std::filesystem::path& imagePath) { m_Image.InitAsync(renderer, specs, samplerSpecs, imagePath); }
 		inline void Destroy(const RendererID renderer) { m_Image.Destroy(renderer); }
 
         // Methods
 		inline void SetData(const RendererID renderer, void* data, size_t size) { m_Image.SetData(renderer, data, size); }
+		inline void GetData(const RendererID renderer, std::vector<uint8_t>& data, ImageLayout current) { m_Image.GetData(renderer, data, current); } // Note: Requires ImageUsage::TransferSrc, only reads the base level
 
 		inline void Resize(const RendererID renderer, uint32_t width, uint32_t height) { m_Image.Resize(renderer, width, height); }
 
@@ -53,6 +57,9 @@ namespace Lunar::Internal
 		inline uint32_t GetWidth() const { return m_Image.GetWidth(); }
 		inline uint32_t GetHeight() const { return m_Image.GetHeight(); }
 
+		inline bool IsLoaded() const { return m_Image.IsLoaded(); }
+		inline bool HasFailed() const { return m_Image.HasFailed(); }
+
         // Internal
         // Note: This is an internal function, do not call.
         inline ImageType& GetInternalImage() { return m_Image; }
@@ -88,7 +88,25 @@ namespace Lunar::Internal
 		sRGB,
 		Depth32SFloat,
 		Depth32SFloatS8,
-		Depth24UnormS8
+		Depth24UnormS8,
+
+		// Block-compressed (sampled only, mips must be pre-baked)
+		BC1, BC1sRGB,			// RGB(A), 4x4 blocks of 8 bytes
+		BC2, BC2sRGB,			// RGBA (explicit alpha), 4x4 blocks of 16 bytes
+		BC3, BC3sRGB,			// RGBA, 4x4 blocks of 16 bytes
+		BC4,					// R, 4x4 blocks of 8 bytes
+		BC5,					// RG, 4x4 blocks of 16 bytes
+		BC6H,					// RGB half float (unsigned), 4x4 blocks of 16 bytes
+		BC7, BC7sRGB,			// RGBA, 4x4 blocks of 16 bytes
+		ETC2RGBA, ETC2RGBAsRGB,	// RGBA, 4x4 blocks of 16 bytes
+		ASTC4x4, ASTC4x4sRGB,	// RGBA, 4x4 blocks of 16 bytes
+		ASTC8x8, ASTC8x8sRGB,	// RGBA, 8x8 blocks of 16 bytes
+	};
+
+	enum class MipmapGeneration : uint8_t
+	{
+		GPU = 0,	// A vkCmdBlitImage per level, requires linear blit support for the format
+		CPU			// A SIMD box filter on the CPU (on a worker thread when loaded asynchronously), uploaded in one copy. Only for 4 byte per texel formats.
 	};
 
 	struct ImageSpecification
@@ -102,6 +120,7 @@ namespace Lunar::Internal
 		uint32_t Height = 0;
 
 		bool MipMaps = true;
+		MipmapGeneration MipMapGeneration = MipmapGeneration::GPU;
 	};
 
 	///////////////////////////////////////////////////////////
@@ -0,0 +1,198 @@
+#include "lupch.h"
+#include "MipChain.hpp"
+
+#include "Lunar/Internal/Utils/Preprocessor.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define LU_MIPCHAIN_X86
+    #include <immintrin.h>
+
+    #if defined(LU_COMPILER_MSVC)
+        #include <intrin.h>
+        #define LU_TARGET_AVX2
+    #else
+        #define LU_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Every row function averages 2x2 source texels into one destination texel, starting at
+    // destination texel 'start'. The SIMD variants return where they stopped, the rest is done by the scalar one.
+    static void DownsampleRowScalar(const uint8_t* row0, const uint8_t* row1, uint8_t* dst, uint32_t srcWidth, uint32_t dstWidth, uint32_t start)
+    {
+        for (uint32_t x = start; x < dstWidth; x++)
+        {
+            const uint32_t x0 = (x * 2) * 4;
+            const uint32_t x1 = std::min((x * 2) + 1, srcWidth - 1) * 4;
+
+            for (uint32_t c = 0; c < 4; c++)
+                dst[(x * 4) + c] = static_cast<uint8_t>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+        }
+    }
+
+    #if defined(LU_MIPCHAIN_X86)
+    static uint32_t DownsampleRowSSE2(const uint8_t* row0, const uint8_t* row1, uint8_t* dst, uint32_t pairs, uint32_t start)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i rounding = _mm_set1_epi16(2);
+
+        uint32_t x = start;
+        for (; x + 4 <= pairs; x += 4) // 8 source texels -> 4 destination texels
+        {
+            const __m128i r0a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + (x * 8)));
+            const __m128i r0b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + (x * 8) + 16));
+            const __m128i r1a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + (x * 8)));
+            const __m128i r1b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + (x * 8) + 16));
+
+            // Vertical sums, widened to 16 bits (2 texels per register)
+            const __m128i s01 = _mm_add_epi16(_mm_unpacklo_epi8(r0a, zero), _mm_unpacklo_epi8(r1a, zero));
+            const __m128i s23 = _mm_add_epi16(_mm_unpackhi_epi8(r0a, zero), _mm_unpackhi_epi8(r1a, zero));
+            const __m128i s45 = _mm_add_epi16(_mm_unpacklo_epi8(r0b, zero), _mm_unpacklo_epi8(r1b, zero));
+            const __m128i s67 = _mm_add_epi16(_mm_unpackhi_epi8(r0b, zero), _mm_unpackhi_epi8(r1b, zero));
+
+            // Horizontal sums, the result lives in the low 64 bits
+            const __m128i h01 = _mm_add_epi16(s01, _mm_srli_si128(s01, 8));
+            const __m128i h23 = _mm_add_epi16(s23, _mm_srli_si128(s23, 8));
+            const __m128i h45 = _mm_add_epi16(s45, _mm_srli_si128(s45, 8));
+            const __m128i h67 = _mm_add_epi16(s67, _mm_srli_si128(s67, 8));
+
+            const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(h01, h23), rounding), 2);
+            const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(h45, h67), rounding), 2);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (x * 4)), _mm_packus_epi16(lo, hi));
+        }
+
+        return x;
+    }
+
+    LU_TARGET_AVX2 static uint32_t DownsampleRowAVX2(const uint8_t* row0, const uint8_t* row1, uint8_t* dst, uint32_t pairs, uint32_t start)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i rounding = _mm256_set1_epi16(2);
+
+        uint32_t x = start;
+        for (; x + 8 <= pairs; x += 8) // 16 source texels -> 8 destination texels
+        {
+            const __m256i r0a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row0 + (x * 8)));
+            const __m256i r0b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row0 + (x * 8) + 32));
+            const __m256i r1a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row1 + (x * 8)));
+            const __m256i r1b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row1 + (x * 8) + 32));
+
+            // Note: Unpacking works per 128-bit lane, so the lanes hold texels [0,1 | 4,5] & [2,3 | 6,7]
+            const __m256i sa0 = _mm256_add_epi16(_mm256_unpacklo_epi8(r0a, zero), _mm256_unpacklo_epi8(r1a, zero));
+            const __m256i sa1 = _mm256_add_epi16(_mm256_unpackhi_epi8(r0a, zero), _mm256_unpackhi_epi8(r1a, zero));
+            const __m256i sb0 = _mm256_add_epi16(_mm256_unpacklo_epi8(r0b, zero), _mm256_unpacklo_epi8(r1b, zero));
+            const __m256i sb1 = _mm256_add_epi16(_mm256_unpackhi_epi8(r0b, zero), _mm256_unpackhi_epi8(r1b, zero));
+
+            const __m256i ha0 = _mm256_add_epi16(sa0, _mm256_srli_si256(sa0, 8));
+            const __m256i ha1 = _mm256_add_epi16(sa1, _mm256_srli_si256(sa1, 8));
+            const __m256i hb0 = _mm256_add_epi16(sb0, _mm256_srli_si256(sb0, 8));
+            const __m256i hb1 = _mm256_add_epi16(sb1, _mm256_srli_si256(sb1, 8));
+
+            const __m256i a = _mm256_srli_epi16(_mm256_add_epi16(_mm256_unpacklo_epi64(ha0, ha1), rounding), 2);
+            const __m256i b = _mm256_srli_epi16(_mm256_add_epi16(_mm256_unpacklo_epi64(hb0, hb1), rounding), 2);
+
+            // Packing is per lane as well, so restore the texel order afterwards
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (x * 4)), packed);
+        }
+
+        return x;
+    }
+
+    static bool SupportsAVX2()
+    {
+        #if defined(LU_COMPILER_MSVC)
+        int info[4] = {};
+        __cpuid(info, 1);
+
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || ((_xgetbv(0) & 0x6) != 0x6)) // The OS must save the YMM registers
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+        #else
+        return __builtin_cpu_supports("avx2");
+        #endif
+    }
+    #endif
+
+    static void DownsampleRow(const uint8_t* row0, const uint8_t* row1, uint8_t* dst, uint32_t srcWidth, uint32_t dstWidth)
+    {
+        uint32_t x = 0;
+
+        #if defined(LU_MIPCHAIN_X86)
+        static const bool s_AVX2 = SupportsAVX2();
+
+        const uint32_t pairs = srcWidth / 2; // Destination texels with 2 source texels available horizontally
+        if (s_AVX2)
+            x = DownsampleRowAVX2(row0, row1, dst, pairs, x);
+        x = DownsampleRowSSE2(row0, row1, dst, pairs, x);
+        #endif
+
+        DownsampleRowScalar(row0, row1, dst, srcWidth, dstWidth, x);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint32_t MipChain::GetLevelCount(uint32_t width, uint32_t height)
+    {
+        return static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
+    }
+
+    size_t MipChain::GetSize(uint32_t width, uint32_t height)
+    {
+        size_t size = 0;
+        for (uint32_t level = 0; level < GetLevelCount(width, height); level++)
+            size += static_cast<size_t>(std::max(width >> level, 1u)) * std::max(height >> level, 1u) * 4;
+
+        return size;
+    }
+
+    void MipChain::Generate(const uint8_t* base, uint32_t width, uint32_t height, uint8_t* dst)
+    {
+        LU_PROFILE("MipChain::Generate()");
+        std::memcpy(dst, base, static_cast<size_t>(width) * height * 4);
+
+        const uint8_t* src = dst;
+        uint8_t* level = dst + (static_cast<size_t>(width) * height * 4);
+
+        uint32_t srcWidth = width;
+        uint32_t srcHeight = height;
+        const uint32_t levels = GetLevelCount(width, height);
+
+        for (uint32_t i = 1; i < levels; i++)
+        {
+            const uint32_t dstWidth = std::max(srcWidth / 2, 1u);
+            const uint32_t dstHeight = std::max(srcHeight / 2, 1u);
+
+            for (uint32_t y = 0; y < dstHeight; y++)
+            {
+                const uint8_t* row0 = src + (static_cast<size_t>(y * 2) * srcWidth * 4);
+                const uint8_t* row1 = src + (static_cast<size_t>(std::min((y * 2) + 1, srcHeight - 1)) * srcWidth * 4);
+
+                DownsampleRow(row0, row1, level + (static_cast<size_t>(y) * dstWidth * 4), srcWidth, dstWidth);
+            }
+
+            src = level;
+            level += static_cast<size_t>(dstWidth) * dstHeight * 4;
+
+            srcWidth = dstWidth;
+            srcHeight = dstHeight;
+        }
+    }
+
+}
\ No newline at end of file
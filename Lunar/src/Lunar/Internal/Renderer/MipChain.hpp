@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // MipChain
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Builds the full mip chain of an 8-bit, 4 channel image on the CPU with a 2x2 box filter.
+    // Uses AVX2 or SSE2 when available. The levels are tightly packed after each other, starting with
+    // (a copy of) the base level, which is exactly the layout needed for one multi-region buffer copy.
+    class MipChain
+    {
+    public:
+        static uint32_t GetLevelCount(uint32_t width, uint32_t height);
+        static size_t GetSize(uint32_t width, uint32_t height); // Note: In bytes, of all levels combined
+
+        static void Generate(const uint8_t* base, uint32_t width, uint32_t height, uint8_t* dst); // Note: dst must be able to hold GetSize() bytes
+    };
+
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Lunar/Internal/Renderer/ShaderSpec.hpp"
 #include "Lunar/Internal/Renderer/BuffersSpec.hpp"
 
+#include <vector>
 #include <unordered_map>
 
 namespace Lunar::Internal
@@ -119,6 +120,7 @@ namespace Lunar::Internal
 
         // Dynamic rendering
         ImageFormat DynamicColourFormat = ImageFormat::BGRA;
+        std::vector<ImageFormat> DynamicColourFormats = { }; // Note: For multiple colour attachments, overrides DynamicColourFormat when not empty
         ImageFormat DynamicDepthFormat = ImageFormat::Depth32SFloat;
         ImageFormat DynamicStencilFormat = ImageFormat::Undefined;
 
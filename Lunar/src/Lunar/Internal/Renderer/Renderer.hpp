@@ -48,22 +48,51 @@ namespace Lunar::Internal
         inline void BeginDynamic(CommandBuffer& cmdBuf, const DynamicRenderState& state) { m_Renderer.BeginDynamic(cmdBuf, state); }
         inline void EndDynamic(CommandBuffer& cmdBuf) { m_Renderer.EndDynamic(cmdBuf); }
 
+        // Note: Records all transitions into the CommandBuffer as a single (synchronization2) pipeline barrier
+        inline void Transition(CommandBuffer& cmdBuf, std::span<const ImageTransition> transitions) { m_Renderer.Transition(cmdBuf, transitions); }
+        // Note: Only valid inside a renderpass or dynamic render scope, clears the depth attachment without ending it
+        inline void ClearDepth(CommandBuffer& cmdBuf, uint32_t width, uint32_t height, float depth = 1.0f) { m_Renderer.ClearDepth(cmdBuf, width, height, depth); }
+
         // Object methods
 		inline void Begin(CommandBuffer& cmdBuf) { m_Renderer.Begin(cmdBuf); }
-		inline void Begin(Renderpass& renderpass) { m_Renderer.Begin(renderpass); }
+		inline void Begin(Renderpass& renderpass, SubpassContents contents = SubpassContents::Inline) { m_Renderer.Begin(renderpass, contents); }
+		inline void Begin(CommandBuffer& secondary, Renderpass& renderpass) { m_Renderer.Begin(secondary, renderpass); } // Note: Begins a secondary CommandBuffer that continues the renderpass
 		inline void End(CommandBuffer& cmdBuf) { m_Renderer.End(cmdBuf); }
 		inline void End(Renderpass& renderpass) { m_Renderer.End(renderpass); }
         inline void Submit(CommandBuffer& cmdBuf, ExecutionPolicy policy, Queue queue = Queue::Graphics, PipelineStage waitStage = PipelineStage::ColourAttachmentOutput, const std::vector<CommandBuffer*>& waitOn = {}) { m_Renderer.Submit(cmdBuf, policy, queue, waitStage, waitOn); }
         inline void Submit(Renderpass& renderpass, ExecutionPolicy policy, Queue queue = Queue::Graphics, PipelineStage waitStage = PipelineStage::ColourAttachmentOutput, const std::vector<CommandBuffer*>& waitOn = {}) { m_Renderer.Submit(renderpass, policy, queue, waitStage, waitOn); }
 
+        // Note: The renderpass has to be begun with SubpassContents::SecondaryCommandBuffers
+        inline void Execute(Renderpass& renderpass, const std::vector<CommandBuffer*>& secondaries) { m_Renderer.Execute(renderpass, secondaries); }
+
+        // Note: Runs the first task on the calling thread & the rest on persistent worker threads, each with its own command pools, and waits for all of them.
+        // Must be called from the thread calling BeginFrame, recording frame command buffers on any other (non worker) thread asserts.
+        // Note 2: Only Begin, End & draw commands are safe inside a task, Submit the recorded CommandBuffers afterwards (in order) from the calling thread.
+        inline void Record(const std::vector<RecordFn>& tasks) { m_Renderer.Record(tasks); }
+
 		inline void Draw(CommandBuffer& cmdBuf, uint32_t vertexCount = 3, uint32_t instanceCount = 1) { m_Renderer.Draw(cmdBuf, vertexCount, instanceCount); }
-		inline void DrawIndexed(CommandBuffer& cmdBuf, uint32_t indexCount, uint32_t instanceCount = 1) { m_Renderer.DrawIndexed(cmdBuf, indexCount, instanceCount); }
+		inline void DrawIndexed(CommandBuffer& cmdBuf, uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0) { m_Renderer.DrawIndexed(cmdBuf, indexCount, instanceCount, firstIndex); }
 		inline void DrawIndexed(CommandBuffer& cmdBuf, IndexBuffer& indexBuffer, uint32_t instanceCount = 1) { m_Renderer.DrawIndexed(cmdBuf, indexBuffer, instanceCount); }
 
+        // Note: Render targets are pooled per frame & their memory is aliased between targets that aren't alive at the same time.
+        // Note 2: Valid until released or until the next BeginFrame, the contents are undefined when acquired.
+        inline Image* AcquireRenderTarget(ImageFormat format, uint32_t width, uint32_t height, ImageUsage usage = ImageUsage::Colour | ImageUsage::Sampled) { return m_Renderer.AcquireRenderTarget(format, width, height, usage); }
+        inline void ReleaseRenderTarget(Image* renderTarget) { m_Renderer.ReleaseRenderTarget(renderTarget); }
+
+        // Note: Copies the last presented frame (in the colour format) into pixels, blocks until the copy finished. Requires a headless window.
+        inline void Readback(std::vector<uint8_t>& pixels) { m_Renderer.Readback(pixels); }
+
+        // Note: Prefer LU_PROFILE_GPU, zones measure the GPU time between their two timestamps in the CommandBuffer.
+        // Note 2: The name has to outlive the results, the results lag behind by the amount of frames in flight.
+        inline uint32_t BeginGPUZone(CommandBuffer& cmdBuf, const char* name) { return m_Renderer.BeginGPUZone(cmdBuf, name); }
+        inline void EndGPUZone(CommandBuffer& cmdBuf, uint32_t zone) { m_Renderer.EndGPUZone(cmdBuf, zone); }
+        inline const std::vector<GPUZoneTiming>& GetGPUTimings() const { return m_Renderer.GetGPUTimings(); }
+
+        // Note: The counters of the last finished frame, they're double buffered so reading them doesn't lock
+        inline void AddFrameStat(FrameStat stat, uint64_t amount = 1) { m_Renderer.AddFrameStat(stat, amount); }
+        inline FrameStats GetFrameStats() const { return m_Renderer.GetFrameStats(); }
+
         // Internal
-        inline void Free(const FreeFn& fn) { m_Renderer.Free(fn); }
-        inline void FreeQueue() { m_Renderer.FreeQueue(); }
-        
         inline void Recreate(uint32_t width, uint32_t height, bool vsync) { m_Renderer.Recreate(width, height, vsync); }
 
         // Getters
@@ -72,7 +101,9 @@ namespace Lunar::Internal
 
         inline ImageFormat GetColourFormat() const { return m_Renderer.GetColourFormat(); }
         inline ImageFormat GetDepthFormat() const { return m_Renderer.GetDepthFormat(); }
+        inline ImageFormat GetCompressedFormat() const { return m_Renderer.GetCompressedFormat(); } // Note: Falls back to RGBA when no block-compressed format is supported
         inline std::vector<Image*> GetSwapChainImages() { return m_Renderer.GetSwapChainImages(); }
+        inline uint32_t GetAcquiredImage() const { return m_Renderer.GetAcquiredImage(); }
 
         // Internal
         // Note: This is an internal function, do not call.
@@ -86,4 +117,24 @@ namespace Lunar::Internal
         RendererType m_Renderer = {};
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // GPUZone
+    ////////////////////////////////////////////////////////////////////////////////////
+    class GPUZone
+    {
+    public:
+        // Constructor & Destructor
+        inline GPUZone(Renderer& renderer, CommandBuffer& cmdBuf, const char* name)
+            : m_Renderer(renderer), m_CommandBuffer(cmdBuf), m_Zone(renderer.BeginGPUZone(cmdBuf, name)) {}
+        inline ~GPUZone() { m_Renderer.EndGPUZone(m_CommandBuffer, m_Zone); }
+
+    private:
+        Renderer& m_Renderer;
+        CommandBuffer& m_CommandBuffer;
+        uint32_t m_Zone;
+    };
+
+    // Note: The name has to outlive the results (e.g. a string literal), the CommandBuffer has to be recording for the whole scope
+    #define LU_PROFILE_GPU(renderer, cmdBuf, name) ::Lunar::Internal::GPUZone luGPUZone(renderer, cmdBuf, name)
+
 }
\ No newline at end of file
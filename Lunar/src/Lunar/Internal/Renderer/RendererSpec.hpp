@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
+#include <vector>
 #include <functional>
 
 #include "Lunar/Internal/Core/WindowSpec.hpp"
@@ -35,7 +37,70 @@ namespace Lunar::Internal
         Compute 
     };
 
-    using FreeFn = std::function<void()>;
+    enum class CommandBufferLevel : uint8_t
+    {
+        Primary = 0,        // Submitted to a queue
+        Secondary,          // Executed from a primary command buffer, see Renderer::Execute
+    };
+
+    enum class RenderMode : uint8_t
+    {
+        Renderpass = 0,     // Static VkRenderPass with a framebuffer per attachment set
+        Dynamic,            // Dynamic rendering, no renderpass/framebuffer objects & transitions through barriers
+    };
+
+    using RecordFn = std::function<void()>;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Barriers
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ImageTransition
+    {
+    public:
+        Image* Target = nullptr;
+        ImageLayout Initial = ImageLayout::Undefined; // Note: Undefined discards the contents
+        ImageLayout Final = ImageLayout::Undefined; // Note: When equal to Initial this is just a memory barrier
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Profiling
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct GPUZoneTiming
+    {
+    public:
+        const char* Name = nullptr;
+        double Start = 0.0;     // Note: In milliseconds, relative to the earliest zone of the frame
+        double Duration = 0.0;  // Note: In milliseconds
+    };
+
+    enum class FrameStat : uint8_t
+    {
+        DrawCalls = 0,
+        Indices,
+        Quads,
+        VertexBytes,        // Note: Uploaded to vertex buffers
+        StagingAllocations,
+        DescriptorWrites,
+        Submits,            // Note: Calls to vkQueueSubmit(2)
+        Barriers,           // Note: Pipeline barrier commands recorded by Transition(), not the barriers inside them
+        PipelineBinds,
+
+        Count
+    };
+
+    struct FrameStats
+    {
+    public:
+        uint64_t DrawCalls = 0;
+        uint64_t Indices = 0;
+        uint64_t Quads = 0;
+        uint64_t VertexBytes = 0;
+        uint64_t StagingAllocations = 0;
+        uint64_t DescriptorWrites = 0;
+        uint64_t Submits = 0;
+        uint64_t Barriers = 0;
+        uint64_t PipelineBinds = 0;
+    };
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Dynamic Rendering
@@ -43,12 +108,16 @@ namespace Lunar::Internal
     struct DynamicRenderState
     {
     public:
-        Image* ColourAttachment = nullptr; // If using swapchain images use Renderer::GetAcquiredImage() as the index.
+        // Note: If using swapchain images use Renderer::GetAcquiredImage() as the index into GetSwapChainImages().
+        // Note 2: The attachments have to be in ColourLayout/DepthLayout already, use Renderer::Transition() before BeginDynamic().
+        std::span<Image* const> ColourAttachments = { }; // Note: Should match the pipeline's DynamicColourFormat(s), only has to outlive the BeginDynamic() call
+        ImageLayout ColourLayout = ImageLayout::Colour;
         LoadOperation ColourLoadOp = LoadOperation::Clear;
         StoreOperation ColourStoreOp = StoreOperation::Store;
         Vec4<float> ColourClearValue = { 0.0f, 0.0f, 0.0f, 1.0f };
 
         Image* DepthAttachment = nullptr;
+        ImageLayout DepthLayout = ImageLayout::DepthStencil;
         LoadOperation DepthLoadOp = LoadOperation::Clear;
         StoreOperation DepthStoreOp = StoreOperation::Store;
         float DepthClearValue = 1.0f;
@@ -66,6 +135,9 @@ namespace Lunar::Internal
 
         WindowSpecification::BufferMode Buffers = WindowSpecification::BufferMode::Triple;
         bool VSync = true;
+
+        // Note: When enabled Submit() only records the submission, all recorded submissions get flushed in EndFrame() using as few vkQueueSubmit2 calls as possible.
+        bool DeferredSubmission = false;
     };
 
     using RendererID = uint8_t;
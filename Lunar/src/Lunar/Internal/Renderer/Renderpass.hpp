@@ -43,6 +43,8 @@ namespace Lunar::Internal
         // Methods
         inline void Resize(const RendererID renderer, uint32_t width, uint32_t height) { return m_Renderpass.Resize(renderer, width, height); }
 
+        inline void SetDepthAttachment(const RendererID renderer, Image* depth) { m_Renderpass.SetDepthAttachment(renderer, depth); }
+
         // Getters
         inline Vec2<uint32_t> GetSize() const { return m_Renderpass.GetSize(); }
 
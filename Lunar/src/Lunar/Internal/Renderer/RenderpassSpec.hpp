@@ -39,6 +39,12 @@ namespace Lunar::Internal
         NoneEXT = None,
     };
 
+    enum class SubpassContents : uint8_t
+    {
+        Inline = 0,                 // Commands are recorded directly into the renderpass' command buffer
+        SecondaryCommandBuffers,    // Commands are only executed from secondary command buffers, see Renderer::Execute
+    };
+
     enum class RenderpassUsage : uint8_t
     {
         None = 0,
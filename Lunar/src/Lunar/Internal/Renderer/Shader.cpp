@@ -18,7 +18,7 @@ namespace Lunar::Internal
 
 		std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 		if (content.empty())
-			LU_LOG_WARN("[Shader] GLSL file: '{0}' is empty, this will 'cause internal errors.", path.string());
+			LU_LOG_CAT(Warn, Renderer, "[Shader] GLSL file: '{0}' is empty, this will 'cause internal errors.", path.string());
 
 		return content;
 	}
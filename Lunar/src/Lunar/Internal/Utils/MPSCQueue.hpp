@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // MPSCQueue
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: A bounded lock-free ring for many producers & a single consumer.
+    // Every slot carries a sequence number, a producer claims a slot with a single CAS on the head
+    // and publishes it by bumping the slot's sequence, so the consumer never has to touch the head.
+    template<typename T, size_t Capacity>
+    class MPSCQueue
+    {
+    public:
+        static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0), "[MPSCQueue] Capacity has to be a power of 2.");
+    public:
+        // Constructor & Destructor
+        MPSCQueue()
+            : m_Slots(std::make_unique<Slot[]>(Capacity))
+        {
+            for (size_t i = 0; i < Capacity; i++)
+                m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+        ~MPSCQueue() = default;
+
+        // Methods
+        bool TryPush(T&& value) // Note: Returns false when the queue is full
+        {
+            size_t position = m_Head.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Slot& slot = m_Slots[position & (Capacity - 1)];
+                const size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                if (difference == 0)
+                {
+                    if (m_Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        slot.Value = std::move(value);
+                        slot.Sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_Head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool TryPop(T& value) // Note: Only call from the consumer
+        {
+            Slot& slot = m_Slots[m_Tail & (Capacity - 1)];
+            if (slot.Sequence.load(std::memory_order_acquire) != (m_Tail + 1))
+                return false;
+
+            value = std::move(slot.Value);
+            slot.Sequence.store(m_Tail + Capacity, std::memory_order_release);
+            m_Tail++;
+            return true;
+        }
+
+    private:
+        struct Slot
+        {
+        public:
+            std::atomic<size_t> Sequence = 0;
+            T Value = {};
+        };
+
+    private:
+        std::unique_ptr<Slot[]> m_Slots = nullptr;
+
+        alignas(64) std::atomic<size_t> m_Head = 0;
+        alignas(64) size_t m_Tail = 0;
+    };
+
+}
\ No newline at end of file
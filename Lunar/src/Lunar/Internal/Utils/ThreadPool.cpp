@@ -0,0 +1,93 @@
+#include "lupch.h"
+#include "ThreadPool.hpp"
+
+#include "Lunar/Internal/IO/Print.hpp"
+#include "Lunar/Internal/Utils/Profiler.hpp"
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init & Destroy
+    ////////////////////////////////////////////////////////////////////////////////////
+    void ThreadPool::Init(uint32_t threads, const ThreadInitFn& onStart)
+    {
+        LU_ASSERT((threads > 0), "[ThreadPool] Tried to create a thread pool without threads.");
+        m_Running = true;
+
+        m_Threads.reserve(threads);
+        for (uint32_t i = 0; i < threads; i++)
+            m_Threads.emplace_back([this, i, onStart]() { Run(i, onStart); });
+    }
+
+    void ThreadPool::Destroy()
+    {
+        {
+            std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+            m_Running = false;
+            m_Jobs.clear();
+            m_Head = 0;
+            m_Count = 0;
+        }
+        m_Condition.notify_all();
+
+        for (auto& thread : m_Threads)
+            thread.join();
+
+        m_Threads.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void ThreadPool::Push(JobFn&& job)
+    {
+        {
+            std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+            // Grow the ring, keeping the queued jobs in order
+            if (m_Count == m_Jobs.size())
+            {
+                std::vector<JobFn> jobs(std::max<size_t>(m_Jobs.size() * 2, 16));
+                for (size_t i = 0; i < m_Count; i++)
+                    jobs[i] = std::move(m_Jobs[(m_Head + i) % m_Jobs.size()]);
+
+                m_Jobs = std::move(jobs);
+                m_Head = 0;
+            }
+
+            m_Jobs[(m_Head + m_Count) % m_Jobs.size()] = std::move(job);
+            m_Count++;
+        }
+        m_Condition.notify_one();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void ThreadPool::Run(uint32_t index, const ThreadInitFn& onStart)
+    {
+        if (onStart)
+            onStart(index);
+
+        while (true)
+        {
+            JobFn job = {};
+            {
+                std::unique_lock<std::mutex> lock(m_ThreadSafety);
+                m_Condition.wait(lock, [this]() { return !m_Running || m_Count != 0; });
+
+                if (!m_Running)
+                    return;
+
+                job = std::move(m_Jobs[m_Head]);
+                m_Head = (m_Head + 1) % m_Jobs.size();
+                m_Count--;
+            }
+
+            LU_PROFILE("ThreadPool::Run::Job");
+            job();
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: A fixed set of worker threads consuming a FIFO job queue.
+    // Jobs must not throw, and must not keep references to anything destroyed before the pool.
+    // Note 2: The queue is a ring that keeps its capacity, so pushing small jobs doesn't allocate in steady state.
+    class ThreadPool
+    {
+    public:
+        using JobFn = std::function<void()>;
+        using ThreadInitFn = std::function<void(uint32_t index)>; // Note: Runs on every worker thread before it takes jobs
+    public:
+        // Constructor & Destructor
+        ThreadPool() = default;
+        ~ThreadPool() = default;
+
+        // Init & Destroy
+        void Init(uint32_t threads = std::max(std::thread::hardware_concurrency(), 2u) - 1u, const ThreadInitFn& onStart = {});
+        void Destroy(); // Note: Waits for the jobs that are currently running, queued jobs are dropped
+
+        // Methods
+        void Push(JobFn&& job);
+
+        // Getters
+        inline uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Threads.size()); }
+
+    private:
+        // Private methods
+        void Run(uint32_t index, const ThreadInitFn& onStart);
+
+    private:
+        std::mutex m_ThreadSafety = {};
+        std::condition_variable m_Condition = {};
+        bool m_Running = false;
+
+        std::vector<JobFn> m_Jobs = { };
+        size_t m_Head = 0;
+        size_t m_Count = 0;
+
+        std::vector<std::thread> m_Threads = { };
+    };
+
+}
\ No newline at end of file
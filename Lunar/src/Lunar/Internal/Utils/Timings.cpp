@@ -0,0 +1,53 @@
+#include "lupch.h"
+#include "Timings.hpp"
+
+namespace Lunar::Internal
+{
+
+    namespace
+    {
+        static std::mutex s_TimingsMutex = {};
+        static std::unordered_map<const char*, std::vector<double>> s_Phases = { }; // Note: Keyed by pointer so recording doesn't allocate a string
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void Timings::Enable(bool enabled)
+    {
+        s_Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void Timings::Record(const char* phase, double milliseconds)
+    {
+        std::scoped_lock<std::mutex> lock(s_TimingsMutex);
+        s_Phases[phase].push_back(milliseconds);
+    }
+
+    Timings::PhaseMap Timings::Collect()
+    {
+        std::scoped_lock<std::mutex> lock(s_TimingsMutex);
+
+        PhaseMap phases = {};
+        for (auto& [phase, durations] : s_Phases)
+        {
+            if (durations.empty())
+                continue;
+
+            auto& entry = phases[phase];
+            entry.insert(entry.end(), durations.begin(), durations.end());
+            durations.clear();
+        }
+
+        return phases;
+    }
+
+    void Timings::Reserve(size_t count)
+    {
+        std::scoped_lock<std::mutex> lock(s_TimingsMutex);
+
+        for (auto& [phase, durations] : s_Phases)
+            durations.reserve(durations.size() + count);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Lunar::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Timings
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Collects CPU durations of named phases (e.g. for the Benchmark), unlike the profiler this also works in Dist.
+    // When disabled (the default) a timed scope costs a single relaxed atomic load.
+    class Timings
+    {
+    public:
+        using PhaseMap = std::unordered_map<std::string, std::vector<double>>; // Note: Durations in milliseconds, in the order they were recorded
+    public:
+        // Static methods
+        static void Enable(bool enabled);
+        static inline bool Enabled() { return s_Enabled.load(std::memory_order_relaxed); }
+
+        static void Record(const char* phase, double milliseconds);
+        static PhaseMap Collect(); // Note: Returns & clears everything recorded so far, the storage of known phases is kept
+        static void Reserve(size_t count); // Note: Reserves space for count more durations of every phase recorded before
+
+    private:
+        inline static std::atomic<bool> s_Enabled = false;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ScopedTiming
+    ////////////////////////////////////////////////////////////////////////////////////
+    class ScopedTiming
+    {
+    public:
+        // Constructor & Destructor
+        inline ScopedTiming(const char* phase)
+            : m_Phase(Timings::Enabled() ? phase : nullptr)
+        {
+            if (m_Phase)
+                m_Start = std::chrono::steady_clock::now();
+        }
+        inline ~ScopedTiming()
+        {
+            if (m_Phase)
+                Timings::Record(m_Phase, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Start).count());
+        }
+
+    private:
+        const char* m_Phase;
+        std::chrono::steady_clock::time_point m_Start = {};
+    };
+
+    // Note: The name has to be a string literal (or outlive the next Timings::Collect)
+    #define LU_TIME(name) ::Lunar::Internal::ScopedTiming luScopedTiming(name)
+
+}
\ No newline at end of file
@@ -29,6 +29,11 @@ namespace Lunar
 		m_Renderer->Present();
 	}
 
+	void Renderer::Readback(std::vector<uint8_t>& pixels)
+	{
+		m_Renderer->Readback(pixels);
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,13 @@ namespace Lunar
 		void BeginFrame();
 		void EndFrame();
 
+		void Readback(std::vector<uint8_t>& pixels); // Note: The last frame in BGRA, only available for headless windows
+
+		// Note: The GPU zones (e.g. BatchRenderer2D::Draw) of the last finished frame, lags behind by the amount of frames in flight
+		inline const std::vector<GPUZoneTiming>& GetGPUTimings() const { return m_Renderer->GetGPUTimings(); }
+		// Note: Draw calls, quads, uploads, submits etc. of the last finished frame (from BeginFrame to BeginFrame)
+		inline FrameStats GetFrameStats() const { return m_Renderer->GetFrameStats(); }
+
 		// Getters
 		inline RendererID GetID() const { return static_cast<RendererID>(m_Renderer->GetID()); }
 
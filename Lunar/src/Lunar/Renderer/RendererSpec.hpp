@@ -10,4 +10,10 @@ namespace Lunar
 	////////////////////////////////////////////////////////////////////////////////////
 	using RendererID = Internal::RendererID;
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Profiling
+	////////////////////////////////////////////////////////////////////////////////////
+	using GPUZoneTiming = Internal::GPUZoneTiming; // Note: In milliseconds, Start is relative to the first zone of the frame
+	using FrameStats = Internal::FrameStats;
+
 }
\ No newline at end of file
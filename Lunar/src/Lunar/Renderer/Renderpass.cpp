@@ -25,6 +25,18 @@ namespace Lunar
 			return Internal::LoadOperation::None;
 		}
 
+		Internal::RenderMode RenderModeToInternalRenderMode(RenderMode mode)
+		{
+			switch (mode)
+			{
+			case RenderMode::Renderpass:		return Internal::RenderMode::Renderpass;
+			case RenderMode::Dynamic:			return Internal::RenderMode::Dynamic;
+			}
+
+			LU_ASSERT(false, "[Renderpass] Invalid RenderMode passed in.");
+			return Internal::RenderMode::Renderpass;
+		}
+
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -32,20 +44,25 @@ namespace Lunar
 	////////////////////////////////////////////////////////////////////////////////////
 	Renderpass2D::~Renderpass2D()
 	{
+		// Note: Otherwise the renderer would resize a destroyed pass
+		if (m_Initialized)
+			Renderer::GetRenderer(m_RendererID).RemovePass(this);
+
 		m_Renderer2D.Destroy();
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Init & Destroy
 	////////////////////////////////////////////////////////////////////////////////////
-	void Renderpass2D::Init(const RendererID renderer, LoadOperation loadOperation)
+	void Renderpass2D::Init(const RendererID renderer, LoadOperation loadOperation, RenderMode mode)
 	{
 		m_RendererID = renderer;
 
 		Renderer::GetRenderer(renderer).AddPass(this);
+		m_Initialized = true;
 
 		Internal::Renderer& rendererObj = Internal::Renderer::GetRenderer(static_cast<Internal::RendererID>(m_RendererID));
-		m_Renderer2D.Init(renderer, rendererObj.GetSwapChainImages(), LoadOperationToInternalLoadOperation(loadOperation));
+		m_Renderer2D.Init(renderer, rendererObj.GetSwapChainImages(), LoadOperationToInternalLoadOperation(loadOperation), RenderModeToInternalRenderMode(mode));
 	}
 
 	void Renderpass2D::Init(const RendererID renderer, Texture& texture, LoadOperation loadOperation)
@@ -84,6 +101,11 @@ namespace Lunar
 		m_Renderer2D.SetCamera(view, projection);
 	}
 
+	void Renderpass2D::NextLayer(bool clearDepth)
+	{
+		m_Renderer2D.NextLayer(clearDepth);
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Methods
 	////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,12 @@ namespace Lunar
 		Load,
 	};
 
+	enum class RenderMode : uint8_t
+	{
+		Renderpass = 0,		// Uses a static renderpass with framebuffers
+		Dynamic,			// Uses dynamic rendering, no framebuffers to recreate on resize
+	};
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Renderpass2D
 	////////////////////////////////////////////////////////////////////////////////////
@@ -39,12 +45,12 @@ namespace Lunar
 	public:
 		// Constructor & Destructor
 		Renderpass2D() = default;
-		Renderpass2D(const RendererID renderer, LoadOperation loadOperation = LoadOperation::Clear) { Init(renderer, loadOperation); }
+		Renderpass2D(const RendererID renderer, LoadOperation loadOperation = LoadOperation::Clear, RenderMode mode = RenderMode::Renderpass) { Init(renderer, loadOperation, mode); }
 		Renderpass2D(const RendererID renderer, Texture& texture, LoadOperation loadOperation = LoadOperation::Clear) { Init(renderer, texture, loadOperation); }
 		~Renderpass2D();
 
 		// Init & Destroy
-		void Init(const RendererID renderer, LoadOperation loadOperation = LoadOperation::Clear);
+		void Init(const RendererID renderer, LoadOperation loadOperation = LoadOperation::Clear, RenderMode mode = RenderMode::Renderpass);
 		void Init(const RendererID renderer, Texture& texture, LoadOperation loadOperation = LoadOperation::Clear);
 
 		// Methods
@@ -55,6 +61,8 @@ namespace Lunar
 		void DrawQuad(const Vec3<float>& position, const Vec2<float>& size, Texture& texture, const Vec4<float>& colour = { 1.0f, 1.0f, 1.0f, 1.0f });
 
 		void Set2DCamera(const Mat4& view, const Mat4& projection);
+		// Note: Draws after this go on top of the previous layer in the same render scope & submit (e.g. Scene -> UI)
+		void NextLayer(bool clearDepth = true);
 
 		// Other methods
 		void Resize(uint32_t width, uint32_t height);
@@ -62,6 +70,7 @@ namespace Lunar
 	private:
 		RendererID m_RendererID = 0;
 		Renderpass2DRendererType m_Renderer2D = {};
+		bool m_Initialized = false; // Note: Whether the pass was added to the renderer
 
 		friend class Renderer;
 	};
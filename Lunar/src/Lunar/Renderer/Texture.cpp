@@ -57,6 +57,26 @@ namespace Lunar
 		}, path);
 	}
 
+	void Texture::LoadAsync(const RendererID renderer, const std::filesystem::path& path)
+	{
+		m_RendererID = renderer;
+
+		m_Image.InitAsync(renderer, {
+			.Usage = Internal::ImageUsage::Colour | Internal::ImageUsage::Sampled,
+			.Layout = Internal::ImageLayout::ShaderRead,
+			.Format = Internal::ImageFormat::RGBA,
+
+			.Width = 0, .Height = 0,
+
+			.MipMaps = false,
+		}, {
+			.MagFilter = Internal::FilterMode::Nearest,
+			.MinFilter = Internal::FilterMode::Nearest,
+			.Address = Internal::AddressMode::Repeat,
+			.Mipmaps = Internal::MipmapMode::Nearest,
+		}, path);
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Methods
 	////////////////////////////////////////////////////////////////////////////////////
@@ -28,12 +28,17 @@ namespace Lunar
 		// Init
 		void Init(const RendererID renderer, uint32_t width, uint32_t height);
 		void Init(const RendererID renderer, const std::filesystem::path& path);
+		void LoadAsync(const RendererID renderer, const std::filesystem::path& path); // Note: Draws as the white texture until the image has been decoded & uploaded
 
 		// Methods
 		void SetData(void* data, size_t size);
 
 		void Resize(uint32_t width, uint32_t height);
 
+		// Getters
+		inline bool IsLoaded() const { return m_Image.IsLoaded(); }
+		inline bool HasFailed() const { return m_Image.HasFailed(); } // Note: A failed LoadAsync keeps drawing as the white texture
+
 	private:
 		RendererID m_RendererID = 0;
 		Internal::Image m_Image = {};
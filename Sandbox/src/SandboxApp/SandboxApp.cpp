@@ -13,11 +13,7 @@ SandboxApp::SandboxApp()
 	});
 	m_Window.SetEventCallback([this](Event e) { OnEvent(e); });
 
-	m_ScenePass.Init(m_Window.GetRenderer().GetID(), LoadOperation::Clear);
-	m_UIPass.Init(m_Window.GetRenderer().GetID(), LoadOperation::Load);
-
-	m_ScenePass.Set2DCamera(Mat4(1.0f), Mat4(1.0f));
-	m_UIPass.Set2DCamera(Mat4(1.0f), Mat4(1.0f));
+	m_2DPass.Init(m_Window.GetRenderer().GetID(), LoadOperation::Clear);
 }
 
 SandboxApp::~SandboxApp()
@@ -36,11 +32,16 @@ void SandboxApp::Render()
 {
 	m_Window.GetRenderer().BeginFrame();
 
-	m_ScenePass.Begin();
-	m_ScenePass.End();
+	m_2DPass.Begin();
+
+	// Scene
+	m_2DPass.Set2DCamera(Mat4(1.0f), Mat4(1.0f));
+
+	// UI
+	m_2DPass.NextLayer();
+	m_2DPass.Set2DCamera(Mat4(1.0f), Mat4(1.0f));
 
-	m_UIPass.Begin();
-	m_UIPass.End();
+	m_2DPass.End();
 
 	m_Window.GetRenderer().EndFrame();
 
@@ -56,8 +57,7 @@ void SandboxApp::OnEvent(Event event)
 
 	handler.Handle<WindowResizeEvent>([this](WindowResizeEvent& wre)
 	{
-		m_ScenePass.Resize(wre.GetWidth(), wre.GetHeight());
-		m_UIPass.Resize(wre.GetWidth(), wre.GetHeight());
+		m_2DPass.Resize(wre.GetWidth(), wre.GetHeight());
 	});
 	handler.Handle<WindowCloseEvent>([this](WindowCloseEvent&)
 	{
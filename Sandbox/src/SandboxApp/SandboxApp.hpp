@@ -27,6 +27,5 @@ private:
 	Window m_Window = {};
 	bool m_Running = true;
 
-	Renderpass2D m_UIPass = {};
-	Renderpass2D m_ScenePass = {};
+	Renderpass2D m_2DPass = {}; // Note: Scene & UI are layers of the same pass
 };
\ No newline at end of file
@@ -143,4 +143,5 @@ group "Lunar"
 group ""
 
 include "Sandbox"
+include "Benchmark"
 ------------------------------------------------------------------------------
\ No newline at end of file